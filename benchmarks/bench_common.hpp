@@ -0,0 +1,79 @@
+#ifndef CONDUIT_BENCH_COMMON_HPP
+#define CONDUIT_BENCH_COMMON_HPP
+
+/**
+ * @file bench_common.hpp
+ * @brief Shared timing helpers for the Conduit microbenchmarks
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bench {
+
+/**
+ * @brief Timestamp counter where available, nanoseconds otherwise
+ */
+inline uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline const char* cycle_unit() {
+#if defined(__x86_64__) || defined(__i386__)
+    return "cycle";
+#else
+    return "ns";
+#endif
+}
+
+/**
+ * @brief Keep the optimizer from discarding a computed value
+ */
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Run fn iterations times and return the best per-iteration cycle count
+ *
+ * The minimum over several rounds filters out scheduler noise, which matters
+ * more than averaging for sub-microsecond kernels.
+ */
+template <typename Fn>
+uint64_t best_cycles(int iterations, Fn&& fn) {
+    constexpr int ROUNDS = 5;
+    uint64_t best = UINT64_MAX;
+    for (int round = 0; round < ROUNDS; ++round) {
+        uint64_t start = read_cycles();
+        for (int i = 0; i < iterations; ++i) {
+            fn();
+        }
+        uint64_t elapsed = (read_cycles() - start) / static_cast<uint64_t>(iterations);
+        if (elapsed < best) best = elapsed;
+    }
+    return best == 0 ? 1 : best;
+}
+
+inline void report(const std::string& name, size_t bytes, uint64_t baseline, uint64_t candidate) {
+    std::printf("%-28s %10zu B  baseline %8.3f B/%s  new %8.3f B/%s  speedup %5.2fx\n",
+                name.c_str(), bytes,
+                static_cast<double>(bytes) / static_cast<double>(baseline), cycle_unit(),
+                static_cast<double>(bytes) / static_cast<double>(candidate), cycle_unit(),
+                static_cast<double>(baseline) / static_cast<double>(candidate));
+}
+
+} // namespace bench
+
+#endif // CONDUIT_BENCH_COMMON_HPP
@@ -0,0 +1,183 @@
+/**
+ * @file bench_http_parser.cpp
+ * @brief Response parsing throughput: incremental parser vs. the old
+ *        find-on-every-recv path
+ *
+ * Both sides see the response in 4 KB pieces, as recv() hands it over, so
+ * the numbers reflect parsing work rather than socket overhead.
+ */
+
+#include "bench_common.hpp"
+#include "http_parser.hpp"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t RECV_SIZE = 4096;
+
+/**
+ * @brief The receive and parse path as it was before ResponseParser
+ */
+namespace legacy {
+
+    std::string receive_response(const std::string& wire) {
+        std::string response;
+        int content_length = -1;
+        bool headers_complete = false;
+        size_t header_end_pos = 0;
+        size_t offset = 0;
+
+        while (offset < wire.size()) {
+            size_t bytes_received = std::min(RECV_SIZE, wire.size() - offset);
+            response.append(wire.data() + offset, bytes_received);
+            offset += bytes_received;
+
+            if (!headers_complete) {
+                size_t header_end = response.find("\r\n\r\n");
+                if (header_end != std::string::npos) {
+                    headers_complete = true;
+                    header_end_pos = header_end + 4;
+
+                    size_t cl_pos = response.find("Content-Length: ");
+                    if (cl_pos != std::string::npos && cl_pos < header_end) {
+                        size_t cl_start = cl_pos + 16;
+                        size_t cl_end = response.find("\r\n", cl_start);
+                        if (cl_end != std::string::npos) {
+                            content_length = std::stoi(response.substr(cl_start, cl_end - cl_start));
+                        }
+                    }
+                }
+            }
+
+            if (headers_complete && content_length >= 0) {
+                size_t body_length = response.length() - header_end_pos;
+                if (body_length >= static_cast<size_t>(content_length)) {
+                    break;
+                }
+            }
+        }
+        return response;
+    }
+
+    size_t parse_http_response(const std::string& response_data) {
+        size_t header_end = response_data.find("\r\n\r\n");
+        std::string headers_section = response_data.substr(0, header_end);
+        std::string body = response_data.substr(header_end + 4);
+
+        size_t first_line_end = headers_section.find("\r\n");
+        std::string status_line = headers_section.substr(0, first_line_end);
+        size_t first_space = status_line.find(' ');
+        size_t second_space = status_line.find(' ', first_space + 1);
+        int status_code = std::stoi(status_line.substr(first_space + 1, second_space - first_space - 1));
+
+        std::map<std::string, std::string> headers;
+        std::istringstream header_stream(headers_section.substr(first_line_end + 2));
+        std::string header_line;
+        while (std::getline(header_stream, header_line)) {
+            if (header_line.back() == '\r') {
+                header_line.pop_back();
+            }
+            size_t colon_pos = header_line.find(':');
+            if (colon_pos != std::string::npos) {
+                std::string name = header_line.substr(0, colon_pos);
+                std::string value = header_line.substr(colon_pos + 1);
+                value.erase(0, value.find_first_not_of(" \t"));
+                value.erase(value.find_last_not_of(" \t") + 1);
+                headers[name] = value;
+            }
+        }
+
+        return body.size() + headers.size() + static_cast<size_t>(status_code);
+    }
+
+} // namespace legacy
+
+/**
+ * @brief The Connection::receive_response loop without the socket
+ */
+size_t parse_incremental(const std::string& wire, std::vector<char>& rx_buffer) {
+    conduit::ResponseParser parser;
+    std::string body;
+    size_t rx_begin = 0;
+    size_t rx_end = 0;
+    size_t offset = 0;
+
+    while (true) {
+        if (rx_begin < rx_end) {
+            std::string_view chunk;
+            size_t consumed = parser.feed(rx_buffer.data() + rx_begin, rx_end - rx_begin, chunk);
+            rx_begin += consumed;
+            if (!chunk.empty()) {
+                if (body.empty() && parser.content_length() > 0) {
+                    body.reserve(static_cast<size_t>(parser.content_length()));
+                }
+                body.append(chunk.data(), chunk.size());
+            }
+            if (parser.complete()) break;
+            if (consumed > 0) continue;
+        }
+
+        if (rx_begin == rx_end) {
+            rx_begin = rx_end = 0;
+        } else if (rx_begin > 0) {
+            std::memmove(rx_buffer.data(), rx_buffer.data() + rx_begin, rx_end - rx_begin);
+            rx_end -= rx_begin;
+            rx_begin = 0;
+        }
+        if (rx_end == rx_buffer.size()) {
+            rx_buffer.resize(rx_buffer.size() * 2);
+        }
+
+        size_t bytes_received = std::min({RECV_SIZE, wire.size() - offset, rx_buffer.size() - rx_end});
+        if (bytes_received == 0) {
+            parser.finish();
+            break;
+        }
+        std::memcpy(rx_buffer.data() + rx_end, wire.data() + offset, bytes_received);
+        offset += bytes_received;
+        rx_end += bytes_received;
+    }
+
+    return body.size() + parser.headers().size() + static_cast<size_t>(parser.status_code());
+}
+
+std::string make_response(size_t header_count, size_t body_size) {
+    std::string body(body_size, 'x');
+    std::string response = "HTTP/1.1 200 OK\r\n";
+    response += "Content-Type: application/json\r\n";
+    for (size_t i = 0; i < header_count; ++i) {
+        response += "X-Custom-Header-" + std::to_string(i) + ": value-" + std::string(48, 'v') + "\r\n";
+    }
+    response += "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+    return response + body;
+}
+
+void run_case(const std::string& name, size_t header_count, size_t body_size, int iterations) {
+    std::string wire = make_response(header_count, body_size);
+    std::vector<char> rx_buffer(16 * 1024);
+
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(legacy::parse_http_response(legacy::receive_response(wire)));
+    });
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(parse_incremental(wire, rx_buffer));
+    });
+
+    bench::report(name, wire.size(), baseline, candidate);
+}
+
+} // anonymous namespace
+
+int main() {
+    std::printf("HTTP response parsing (4 KB recv pieces)\n");
+    run_case("small json reply", 12, 2 * 1024, 20000);
+    run_case("large header block", 400, 1024, 500);
+    run_case("1 MB body", 12, 1024 * 1024, 200);
+    run_case("16 MB body", 12, 16 * 1024 * 1024, 10);
+    return 0;
+}
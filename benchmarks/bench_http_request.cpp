@@ -0,0 +1,171 @@
+/**
+ * @file bench_http_request.cpp
+ * @brief Request serialization: scatter-gather parts vs. the old
+ *        ostringstream builder
+ *
+ * Only the work before the send is timed. The old path copied the default
+ * headers into a merged map, formatted everything through a stream and
+ * appended the body to the result. The new one formats the request's own
+ * lines and points iovecs at the pre-rendered defaults and the body.
+ *
+ * The template cases compare a RequestTemplate against those parts for
+ * a request whose path carries two parameters. The template needs a
+ * connection to prepare it, so a listening socket is opened on loopback;
+ * nothing is sent.
+ */
+
+#include "bench_common.hpp"
+#include "http_request.hpp"
+#include "conduit.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Request serialization as it was before RequestParts
+ */
+namespace legacy {
+
+    std::string build_http_request(const std::string& method, const std::string& path,
+                                   const std::string& hostname, const std::string& body,
+                                   const std::map<std::string, std::string>& headers) {
+        std::ostringstream request;
+        request << method << " " << path << " HTTP/1.1\r\n";
+        request << "Host: " << hostname << "\r\n";
+        for (const auto& [name, value] : headers) {
+            request << name << ": " << value << "\r\n";
+        }
+        if (!body.empty()) {
+            request << "Content-Length: " << body.size() << "\r\n";
+        }
+        request << "\r\n";
+        return request.str() + body;
+    }
+
+} // namespace legacy
+
+void run_case(const std::string& name, const std::string& method, size_t body_size, int iterations) {
+    std::map<std::string, std::string> defaults = {
+        {"User-Agent", "Conduit-CPP/1.0"},
+        {"Accept", "application/json"},
+        {"Authorization", "Bearer " + std::string(40, 't')},
+    };
+    std::map<std::string, std::string> headers = {
+        {"Content-Type", "application/json"},
+        {"X-Request-Id", "5f0c6c1e-8d4b-4a5e-9f37-2b1f6c0d9a41"},
+    };
+    std::string body(body_size, 'b');
+    std::string path = "/api/v2/orders?status=open&limit=50";
+
+    std::string wire = legacy::build_http_request(method, path, "api.example.com", body, [&] {
+        auto merged = defaults;
+        merged.insert(headers.begin(), headers.end());
+        return merged;
+    }());
+
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        auto merged = defaults;
+        merged.insert(headers.begin(), headers.end());
+        bench::do_not_optimize(legacy::build_http_request(method, path, "api.example.com", body, merged).size());
+    });
+
+    // Defaults are held by the connection; request headers arrive with each call
+    conduit::HeaderMap default_map(defaults);
+    conduit::RequestParts parts;
+    std::vector<iovec> buffers;
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        conduit::HeaderMap request_headers{{"Content-Type", "application/json"},
+                                           {"X-Request-Id", headers["X-Request-Id"]}};
+        conduit::build_http_request(method, path, "api.example.com", default_map, request_headers, {}, body, parts);
+        buffers.clear();
+        parts.gather(buffers);
+        bench::do_not_optimize(buffers.size());
+    });
+
+    bench::report(name, wire.size(), baseline, candidate);
+}
+
+/**
+ * @brief A loopback port that accepts connections into its backlog
+ */
+class Listener {
+public:
+    Listener() : fd_(socket(AF_INET, SOCK_STREAM, 0)) {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        bind(fd_, reinterpret_cast<sockaddr*>(&address), length);
+        listen(fd_, 4);
+        getsockname(fd_, reinterpret_cast<sockaddr*>(&address), &length);
+        port_ = ntohs(address.sin_port);
+    }
+    ~Listener() { close(fd_); }
+
+    int port() const { return port_; }
+
+private:
+    int fd_;
+    int port_ = 0;
+};
+
+void run_template_case(const std::string& name, const std::string& method, size_t body_size, int iterations) {
+    Listener listener;
+    conduit::ClientConfig config;
+    config.default_headers["Accept"] = "application/json";
+    config.default_headers["Authorization"] = "Bearer " + std::string(40, 't');
+    std::map<std::string, std::string> headers = {
+        {"Content-Type", "application/json"},
+        {"X-Client", "orders-service"},
+    };
+    std::string body(body_size, 'b');
+    std::string user = "1842";
+    std::string order = "a7f3c2";
+
+    conduit::HttpClient client(config);
+    auto conn = client.connect("127.0.0.1", listener.port());
+    auto request = conn.prepare(method, "/api/v2/users/{user}/orders/{order}?expand=items", headers);
+
+    // What Connection::send_request does for the same request, plus
+    // building the path
+    conduit::HeaderMap default_map(config.default_headers);
+    conduit::RequestParts parts;
+    std::vector<iovec> buffers;
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        std::string path = "/api/v2/users/" + user + "/orders/" + order + "?expand=items";
+        conduit::HeaderMap request_headers{{"Content-Type", "application/json"}, {"X-Client", "orders-service"}};
+        conduit::build_http_request(method, path, "127.0.0.1", default_map, request_headers, {}, body, parts);
+        buffers.clear();
+        parts.gather(buffers);
+        bench::do_not_optimize(buffers.size());
+    });
+
+    std::string head;
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        request.render_head({user, order}, body.size(), head);
+        bench::do_not_optimize(head.size());
+    });
+
+    bench::report(name, head.size() + body.size(), baseline, candidate);
+}
+
+} // anonymous namespace
+
+int main() {
+    std::printf("HTTP request serialization\n");
+    run_case("GET, 5 headers", "GET", 0, 20000);
+    run_case("POST 4 KB body", "POST", 4 * 1024, 20000);
+    run_case("POST 4 MB body", "POST", 4 * 1024 * 1024, 50);
+
+    std::printf("\nRequest templates vs. parts\n");
+    run_template_case("GET, 2 slots", "GET", 0, 20000);
+    run_template_case("PUT, 2 slots, 4 KB body", "PUT", 4 * 1024, 20000);
+    return 0;
+}
@@ -0,0 +1,544 @@
+/**
+ * @file bench_json_parser.cpp
+ * @brief JSON parsing throughput: structural index vs. the old
+ *        character-at-a-time parser
+ *
+ * Stage 1 is measured on its own at each instruction set the CPU supports.
+ * parse_json, JsonDocument and the streaming tokenizer are measured against
+ * the parser parse_json used to be, and reading three fields through
+ * JsonView against parsing everything to get them. Number-heavy input is
+ * measured separately, along with float formatting, and so is filling
+ * structs with from_json against copying them out of a parsed JsonValue.
+ * Building and searching objects is compared between the std::map
+ * JsonValue used to hold and the flat JsonObject. JSON Lines parsing is
+ * compared with splitting lines by hand and calling parse_json on each.
+ */
+
+#include "bench_common.hpp"
+#include "json_number.hpp"
+#include "json_structural.hpp"
+#include "conduit.hpp"
+#include <algorithm>
+#include <map>
+#include <cctype>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace legacy {
+    /**
+     * @brief The recursive-descent parser parse_json used before the
+     *        structural index
+     */
+    class JsonParser {
+    public:
+        explicit JsonParser(const std::string& json) : input_(json), pos_(0) {}
+        
+        std::optional<conduit::JsonValue> parse() {
+            skip_whitespace();
+            if (pos_ >= input_.length()) {
+                return std::nullopt;
+            }
+            
+            try {
+                auto result = parse_value();
+                skip_whitespace();
+                if (pos_ < input_.length()) {
+                    throw std::runtime_error("Unexpected characters after JSON value");
+                }
+                return result;
+            } catch (const std::exception&) {
+                return std::nullopt;
+            }
+        }
+        
+    private:
+        std::string input_;
+        size_t pos_;
+        
+        void skip_whitespace() {
+            while (pos_ < input_.length() && std::isspace(input_[pos_])) {
+                pos_++;
+            }
+        }
+        
+        char peek() const {
+            return pos_ < input_.length() ? input_[pos_] : '\0';
+        }
+        
+        char consume() {
+            return pos_ < input_.length() ? input_[pos_++] : '\0';
+        }
+        
+        void expect(char expected) {
+            if (consume() != expected) {
+                throw std::runtime_error("Expected '" + std::string(1, expected) + "'");
+            }
+        }
+        
+        conduit::JsonValue parse_value() {
+            skip_whitespace();
+            
+            switch (peek()) {
+                case 'n': return parse_null();
+                case 't': case 'f': return parse_boolean();
+                case '"': return parse_string();
+                case '[': return parse_array();
+                case '{': return parse_object();
+                case '-': case '0': case '1': case '2': case '3': case '4':
+                case '5': case '6': case '7': case '8': case '9':
+                    return parse_number();
+                default:
+                    throw std::runtime_error("Unexpected character in JSON");
+            }
+        }
+        
+        conduit::JsonValue parse_null() {
+            if (input_.substr(pos_, 4) == "null") {
+                pos_ += 4;
+                return conduit::JsonValue{};
+            }
+            throw std::runtime_error("Expected 'null'");
+        }
+        
+        conduit::JsonValue parse_boolean() {
+            if (input_.substr(pos_, 4) == "true") {
+                pos_ += 4;
+                return conduit::JsonValue{true};
+            } else if (input_.substr(pos_, 5) == "false") {
+                pos_ += 5;
+                return conduit::JsonValue{false};
+            }
+            throw std::runtime_error("Expected boolean value");
+        }
+        
+        conduit::JsonValue parse_string() {
+            expect('"');
+            std::string result;
+            
+            while (peek() != '"' && peek() != '\0') {
+                char c = consume();
+                if (c == '\\') {
+                    // Handle escape sequences
+                    char escaped = consume();
+                    switch (escaped) {
+                        case '"': result += '"'; break;
+                        case '\\': result += '\\'; break;
+                        case '/': result += '/'; break;
+                        case 'b': result += '\b'; break;
+                        case 'f': result += '\f'; break;
+                        case 'n': result += '\n'; break;
+                        case 'r': result += '\r'; break;
+                        case 't': result += '\t'; break;
+                        default:
+                            result += escaped;
+                            break;
+                    }
+                } else {
+                    result += c;
+                }
+            }
+            
+            expect('"');
+            return conduit::JsonValue{result};
+        }
+        
+        conduit::JsonValue parse_number() {
+            size_t start = pos_;
+            
+            // Handle negative sign
+            if (peek() == '-') {
+                consume();
+            }
+            
+            // Parse integer part
+            if (peek() == '0') {
+                consume();
+            } else if (std::isdigit(peek())) {
+                while (std::isdigit(peek())) {
+                    consume();
+                }
+            } else {
+                throw std::runtime_error("Invalid number format");
+            }
+            
+            // Parse decimal part
+            if (peek() == '.') {
+                consume();
+                if (!std::isdigit(peek())) {
+                    throw std::runtime_error("Invalid number format");
+                }
+                while (std::isdigit(peek())) {
+                    consume();
+                }
+            }
+            
+            // Parse exponent part
+            if (peek() == 'e' || peek() == 'E') {
+                consume();
+                if (peek() == '+' || peek() == '-') {
+                    consume();
+                }
+                if (!std::isdigit(peek())) {
+                    throw std::runtime_error("Invalid number format");
+                }
+                while (std::isdigit(peek())) {
+                    consume();
+                }
+            }
+            
+            std::string number_str = input_.substr(start, pos_ - start);
+            return conduit::JsonValue{std::stod(number_str)};
+        }
+        
+        conduit::JsonValue parse_array() {
+            expect('[');
+            skip_whitespace();
+            
+            auto array = std::make_shared<std::vector<std::shared_ptr<conduit::JsonValue>>>();
+            
+            if (peek() == ']') {
+                consume();
+                conduit::JsonValue result;
+                result.set_array(array);
+                return result;
+            }
+            
+            while (true) {
+                array->push_back(std::make_shared<conduit::JsonValue>(parse_value()));
+                skip_whitespace();
+                
+                if (peek() == ']') {
+                    consume();
+                    break;
+                } else if (peek() == ',') {
+                    consume();
+                    skip_whitespace();
+                } else {
+                    throw std::runtime_error("Expected ',' or ']' in array");
+                }
+            }
+            
+            conduit::JsonValue result;
+            result.set_array(array);
+            return result;
+        }
+        
+        conduit::JsonValue parse_object() {
+            expect('{');
+            skip_whitespace();
+            
+            auto object = std::make_shared<conduit::JsonObject>();
+            
+            if (peek() == '}') {
+                consume();
+                conduit::JsonValue result;
+                result.set_object(object);
+                return result;
+            }
+            
+            while (true) {
+                // Parse key
+                if (peek() != '"') {
+                    throw std::runtime_error("Expected string key in object");
+                }
+                conduit::JsonValue key_value = parse_string();
+                std::string key = key_value.as_string();
+                
+                skip_whitespace();
+                expect(':');
+                skip_whitespace();
+                
+                // Parse value
+                (*object)[key] = std::make_shared<conduit::JsonValue>(parse_value());
+                skip_whitespace();
+                
+                if (peek() == '}') {
+                    consume();
+                    break;
+                } else if (peek() == ',') {
+                    consume();
+                    skip_whitespace();
+                } else {
+                    throw std::runtime_error("Expected ',' or '}' in object");
+                }
+            }
+            
+            conduit::JsonValue result;
+            result.set_object(object);
+            return result;
+        }
+    };
+
+    std::optional<conduit::JsonValue> parse_json(const std::string& json_string) {
+        JsonParser parser(json_string);
+        return parser.parse();
+    }
+
+} // namespace legacy
+
+std::string make_records(size_t count) {
+    std::string json = "[";
+    for (size_t i = 0; i < count; ++i) {
+        if (i) json += ",";
+        json += "{\"id\":" + std::to_string(i) + ",\"name\":\"user " + std::to_string(i) +
+                "\",\"email\":\"user" + std::to_string(i) + "@example.com\",\"score\":" +
+                std::to_string(i % 100) + ".25,\"active\":" + (i % 2 ? "true" : "false") +
+                ",\"tags\":[\"alpha\",\"beta\"],\"bio\":\"" + std::string(120, 'b') + "\"}";
+    }
+    return json + "]";
+}
+
+struct Record {
+    int64_t id = 0;
+    std::string name;
+    std::string email;
+    double score = 0;
+    bool active = false;
+    std::vector<std::string> tags;
+    std::string bio;
+};
+CONDUIT_JSON_FIELDS(Record, id, name, email, score, active, tags, bio);
+
+const char* level_name(conduit::detail::SimdLevel level) {
+    switch (level) {
+        case conduit::detail::SimdLevel::Avx2: return "avx2";
+        case conduit::detail::SimdLevel::Sse42: return "sse4.2";
+        default: return "scalar";
+    }
+}
+
+void run_case(const std::string& name, size_t records, int iterations) {
+    using conduit::detail::SimdLevel;
+    std::string json = make_records(records);
+    std::vector<uint32_t> index;
+
+    uint64_t scalar = bench::best_cycles(iterations, [&] {
+        conduit::detail::build_structural_index(json, index, SimdLevel::Scalar);
+        bench::do_not_optimize(index.size());
+    });
+    for (SimdLevel level : {SimdLevel::Sse42, SimdLevel::Avx2}) {
+        if (level > conduit::detail::detected_simd_level()) break;
+        uint64_t simd = bench::best_cycles(iterations, [&] {
+            conduit::detail::build_structural_index(json, index, level);
+            bench::do_not_optimize(index.size());
+        });
+        bench::report(name + " stage 1 " + level_name(level), json.size(), scalar, simd);
+    }
+
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(legacy::parse_json(json)->is_array());
+    });
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(conduit::parse_json(json)->is_array());
+    });
+    bench::report(name + " parse_json", json.size(), baseline, candidate);
+
+    uint64_t document = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(conduit::JsonDocument::parse(json)->root().size());
+    });
+    bench::report(name + " JsonDocument", json.size(), baseline, document);
+
+    // Against the copying document: strings stay in the input
+    uint64_t in_place = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(conduit::JsonDocument::parse_in_place(json)->root().size());
+    });
+    bench::report(name + " JsonDocument in place", json.size(), document, in_place);
+
+    // Events only, fed in recv()-sized pieces
+    conduit::JsonHandler ignore;
+    uint64_t stream = bench::best_cycles(iterations, [&] {
+        conduit::JsonStreamParser parser(ignore);
+        for (size_t offset = 0; offset < json.size(); offset += 4096) {
+            parser.feed(json.data() + offset, std::min<size_t>(4096, json.size() - offset));
+        }
+        bench::do_not_optimize(parser.finish());
+    });
+    bench::report(name + " JsonStreamParser", json.size(), baseline, stream);
+}
+
+void run_lookup(const std::string& name, size_t records, int iterations) {
+    std::string json = "{\"results\":" + make_records(records) +
+                       ",\"meta\":{\"page\":3,\"total\":" + std::to_string(records) +
+                       ",\"next\":\"/items?page=4\"}}";
+
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        auto value = conduit::parse_json(json);
+        const auto& meta = *value->as_object()->at("meta");
+        bench::do_not_optimize(*meta.get_int("page") + *meta.get_int("total") + meta.get_string("next")->size());
+    });
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        conduit::JsonView meta = conduit::JsonView(json)["meta"];
+        bench::do_not_optimize(*meta["page"].as_int() + *meta["total"].as_int() + meta["next"].as_string()->size());
+    });
+    bench::report(name + " 3 keys", json.size(), baseline, candidate);
+}
+
+void run_binding(const std::string& name, size_t records, int iterations) {
+    std::string json = make_records(records);
+
+    // The same records filled from a parsed JsonValue and straight from the text
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        auto value = conduit::parse_json(json);
+        std::vector<Record> out;
+        for (const auto& element : *value->as_array()) {
+            Record record;
+            record.id = *element->get_int64("id");
+            record.name = *element->get_string("name");
+            record.email = *element->get_string("email");
+            record.score = *element->get_number("score");
+            record.active = *element->get_bool("active");
+            for (const auto& tag : *element->as_object()->at("tags")->as_array()) {
+                record.tags.push_back(tag->as_string());
+            }
+            record.bio = *element->get_string("bio");
+            out.push_back(std::move(record));
+        }
+        bench::do_not_optimize(out.size());
+    });
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(conduit::from_json<std::vector<Record>>(json)->size());
+    });
+    bench::report(name + " into structs", json.size(), baseline, candidate);
+}
+
+void run_objects(const std::string& name, size_t records, int iterations) {
+    std::string json = make_records(records);
+    auto document = conduit::JsonDocument::parse(json);
+    using MapObject = std::map<std::string, std::shared_ptr<conduit::JsonValue>>;
+
+    // The same members collected into what JsonValue used to hold and what it holds now
+    std::vector<MapObject> maps;
+    std::vector<conduit::JsonObject> flats;
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        maps.clear();
+        for (const auto& record : document->root().elements()) {
+            MapObject& object = maps.emplace_back();
+            for (const auto& member : record.members()) {
+                object[std::string(member.key.as_string())] = std::make_shared<conduit::JsonValue>(member.value.to_value());
+            }
+        }
+        bench::do_not_optimize(maps.size());
+    });
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        flats.clear();
+        for (const auto& record : document->root().elements()) {
+            conduit::JsonObject& object = flats.emplace_back();
+            object.reserve(record.size());
+            for (const auto& member : record.members()) {
+                object.insert_or_assign(member.key.as_string(), std::make_shared<conduit::JsonValue>(member.value.to_value()));
+            }
+        }
+        bench::do_not_optimize(flats.size());
+    });
+    bench::report(name + " objects build", json.size(), baseline, candidate);
+
+    const std::string keys[] = {"id", "name", "email", "score", "active", "bio"};
+    baseline = bench::best_cycles(iterations, [&] {
+        size_t found = 0;
+        for (const auto& object : maps) {
+            for (const auto& key : keys) found += object.find(key)->second->is_null() ? 0 : 1;
+        }
+        bench::do_not_optimize(found);
+    });
+    candidate = bench::best_cycles(iterations, [&] {
+        size_t found = 0;
+        for (const auto& object : flats) {
+            for (const auto& key : keys) found += object.find(key)->second->is_null() ? 0 : 1;
+        }
+        bench::do_not_optimize(found);
+    });
+    bench::report(name + " objects lookup", json.size(), baseline, candidate);
+}
+
+void run_lines(const std::string& name, size_t records, int iterations) {
+    std::string lines;
+    for (size_t i = 0; i < records; ++i) {
+        lines += "{\"seq\":" + std::to_string(i) + ",\"level\":\"info\",\"msg\":\"request " +
+                 std::to_string(i) + " served\",\"ms\":" + std::to_string(i % 97) + ".5}\n";
+    }
+
+    // What a caller had to do: buffer whole lines, then a JsonValue each
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        size_t count = 0;
+        std::string line;
+        for (size_t offset = 0; offset < lines.size(); offset += 4096) {
+            std::string_view chunk(lines.data() + offset, std::min<size_t>(4096, lines.size() - offset));
+            for (size_t newline; (newline = chunk.find('\n')) != std::string_view::npos;) {
+                line.append(chunk.substr(0, newline));
+                count += conduit::parse_json(line)->get_int64("seq").has_value();
+                line.clear();
+                chunk.remove_prefix(newline + 1);
+            }
+            line.append(chunk);
+        }
+        bench::do_not_optimize(count);
+    });
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        size_t count = 0;
+        conduit::JsonLinesParser parser([&](const conduit::JsonNode& record) {
+            count += record.get_int64("seq").has_value();
+            return true;
+        });
+        for (size_t offset = 0; offset < lines.size(); offset += 4096) {
+            parser.feed(lines.data() + offset, std::min<size_t>(4096, lines.size() - offset));
+        }
+        parser.finish();
+        bench::do_not_optimize(count);
+    });
+    bench::report(name + " JSON Lines", lines.size(), baseline, candidate);
+}
+
+void run_numbers(const std::string& name, size_t count, int iterations) {
+    std::string json = "[";
+    for (size_t i = 0; i < count; ++i) {
+        json += (i ? "," : "") + std::to_string(i * 7919) + "," + std::to_string(static_cast<double>(i) / 7.0);
+    }
+    json += "]";
+
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(legacy::parse_json(json)->is_array());
+    });
+    uint64_t candidate = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(conduit::JsonDocument::parse(json)->root().size());
+    });
+    bench::report(name + " numbers parse", json.size(), baseline, candidate);
+
+    // Formatting alone: what serialize_json used to do per number vs. now
+    std::vector<double> values;
+    for (size_t i = 0; i < count; ++i) {
+        values.push_back(static_cast<double>(i) / 7.0);
+    }
+    std::string out;
+    uint64_t to_string = bench::best_cycles(iterations, [&] {
+        out.clear();
+        for (double value : values) out += std::to_string(value);
+        bench::do_not_optimize(out.size());
+    });
+    uint64_t shortest = bench::best_cycles(iterations, [&] {
+        out.clear();
+        for (double value : values) conduit::detail::append_json_number(out, value);
+        bench::do_not_optimize(out.size());
+    });
+    bench::report(name + " numbers format", out.size(), to_string, shortest);
+}
+
+} // anonymous namespace
+
+int main() {
+    std::printf("JSON parsing (baseline for stage 1 is the scalar classifier)\n");
+    run_case("1 KB", 4, 20000);
+    run_case("64 KB", 256, 500);
+    run_case("4 MB", 16384, 10);
+    run_numbers("4000", 2000, 500);
+    run_lookup("64 KB", 256, 500);
+    run_lookup("4 MB", 16384, 10);
+    run_binding("64 KB", 256, 500);
+    run_binding("4 MB", 16384, 10);
+    run_objects("64 KB", 256, 500);
+    run_objects("4 MB", 16384, 10);
+    run_lines("1000 lines", 1000, 200);
+    return 0;
+}
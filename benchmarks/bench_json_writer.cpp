@@ -0,0 +1,156 @@
+/**
+ * @file bench_json_writer.cpp
+ * @brief JSON serialization throughput: JsonWriter vs. the old
+ *        string-concatenating serializer
+ *
+ * Both produce the same text from the same JsonValue tree. The writer is
+ * measured through serialize_json and appending into a reused buffer, the
+ * way Connection::post_json uses it.
+ */
+
+#include "bench_common.hpp"
+#include "json_number.hpp"
+#include "conduit.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+namespace legacy {
+    /**
+     * @brief The serializer serialize_json used before JsonWriter
+     */
+    class JsonSerializer {
+    public:
+        static std::string serialize(const conduit::JsonValue& value) {
+            JsonSerializer serializer;
+            return serializer.serialize_value(value);
+        }
+        
+    private:
+        std::string serialize_value(const conduit::JsonValue& value) {
+            switch (value.type()) {
+                case conduit::JsonType::Null:
+                    return "null";
+                case conduit::JsonType::Boolean:
+                    return value.as_bool() ? "true" : "false";
+                case conduit::JsonType::Number:
+                    return serialize_number(value);
+                case conduit::JsonType::String:
+                    return serialize_string(value.as_string());
+                case conduit::JsonType::Array:
+                    return serialize_array(value.as_array());
+                case conduit::JsonType::Object:
+                    return serialize_object(value.as_object());
+                default:
+                    throw std::runtime_error("Unknown JSON type");
+            }
+        }
+        
+        std::string serialize_number(const conduit::JsonValue& value) {
+            std::string result;
+            if (value.is_integer()) {
+                conduit::detail::append_json_number(result, value.as_int64());
+            } else {
+                conduit::detail::append_json_number(result, value.as_number());
+            }
+            return result;
+        }
+        
+        std::string serialize_string(const std::string& str) {
+            std::string result = "\"";
+            for (char c : str) {
+                switch (c) {
+                    case '"': result += "\\\""; break;
+                    case '\\': result += "\\\\"; break;
+                    case '\b': result += "\\b"; break;
+                    case '\f': result += "\\f"; break;
+                    case '\n': result += "\\n"; break;
+                    case '\r': result += "\\r"; break;
+                    case '\t': result += "\\t"; break;
+                    default:
+                        result += c;
+                        break;
+                }
+            }
+            result += "\"";
+            return result;
+        }
+        
+        std::string serialize_array(const std::shared_ptr<std::vector<std::shared_ptr<conduit::JsonValue>>>& array) {
+            std::string result = "[";
+            if (array) {
+                for (size_t i = 0; i < array->size(); ++i) {
+                    if (i > 0) result += ",";
+                    result += serialize_value(*(*array)[i]);
+                }
+            }
+            result += "]";
+            return result;
+        }
+        
+        std::string serialize_object(const std::shared_ptr<conduit::JsonObject>& object) {
+            std::string result = "{";
+            if (object) {
+                bool first = true;
+                for (const auto& [key, value] : *object) {
+                    if (!first) result += ",";
+                    first = false;
+                    result += serialize_string(key.str()) + ":" + serialize_value(*value);
+                }
+            }
+            result += "}";
+            return result;
+        }
+    };
+
+} // namespace legacy
+
+conduit::JsonValue make_records(size_t count) {
+    auto records = std::make_shared<std::vector<std::shared_ptr<conduit::JsonValue>>>();
+    for (size_t i = 0; i < count; ++i) {
+        auto record = std::make_shared<conduit::JsonObject>();
+        (*record)["id"] = std::make_shared<conduit::JsonValue>(static_cast<int64_t>(i));
+        (*record)["name"] = std::make_shared<conduit::JsonValue>("user " + std::to_string(i));
+        (*record)["bio"] = std::make_shared<conduit::JsonValue>(std::string(100, 'b') + "\n\"quoted\"");
+        (*record)["score"] = std::make_shared<conduit::JsonValue>(static_cast<double>(i) / 3.0);
+        (*record)["active"] = std::make_shared<conduit::JsonValue>(i % 2 == 0);
+        records->push_back(std::make_shared<conduit::JsonValue>());
+        records->back()->set_object(record);
+    }
+    conduit::JsonValue value;
+    value.set_array(records);
+    return value;
+}
+
+void run_case(const std::string& name, size_t records, int iterations) {
+    conduit::JsonValue value = make_records(records);
+    size_t bytes = conduit::serialize_json(value).size();
+
+    uint64_t baseline = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(legacy::JsonSerializer::serialize(value).size());
+    });
+    uint64_t fresh = bench::best_cycles(iterations, [&] {
+        bench::do_not_optimize(conduit::serialize_json(value).size());
+    });
+    bench::report(name + " serialize_json", bytes, baseline, fresh);
+
+    std::string buffer;
+    uint64_t reused = bench::best_cycles(iterations, [&] {
+        buffer.clear();
+        conduit::JsonWriter(buffer).value(value);
+        bench::do_not_optimize(buffer.size());
+    });
+    bench::report(name + " reused buffer", bytes, baseline, reused);
+}
+
+} // anonymous namespace
+
+int main() {
+    std::printf("JSON serialization\n");
+    run_case("1 KB", 6, 20000);
+    run_case("64 KB", 400, 500);
+    run_case("4 MB", 25000, 10);
+    return 0;
+}
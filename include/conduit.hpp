@@ -10,12 +10,22 @@
  */
 
 #include <string>
+#include <string_view>
+#include <cstdint>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <vector>
 #include <chrono>
 #include <optional>
 #include <variant>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+#include <limits>
+#include <tuple>
+#include <type_traits>
 
 namespace conduit {
 
@@ -31,18 +41,332 @@ enum class JsonType {
     Object
 };
 
+namespace detail {
+    /**
+     * @brief 64-bit FNV-1a; evaluated at compile time for bound field names
+     */
+    constexpr uint64_t json_key_hash(std::string_view key) {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : key) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Whether value truncates to an int64_t; false for NaN and infinities
+     */
+    constexpr bool fits_int64(double value) {
+        return value >= -9223372036854775808.0 && value < 9223372036854775808.0;
+    }
+
+    /**
+     * @brief value truncated, clamped to the int64_t range; 0 for NaN
+     */
+    constexpr int64_t saturate_int64(double value) {
+        if (fits_int64(value)) return static_cast<int64_t>(value);
+        if (value != value) return 0;
+        return value < 0 ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max();
+    }
+} // namespace detail
+
+class JsonValue;
+
+/**
+ * @brief Object member name with its hash computed once
+ *
+ * Names up to MAX_INTERNED_LENGTH bytes are interned: the text is stored
+ * once per process and every key with that name points at it, so the
+ * field names an API repeats in every response cost nothing per object.
+ * The pool holds at most MAX_INTERNED names; later new names, and longer
+ * ones, are kept by the key itself.
+ */
+class JsonKey {
+public:
+    static constexpr size_t MAX_INTERNED_LENGTH = 64;
+    static constexpr size_t MAX_INTERNED = 4096;
+
+    JsonKey() : JsonKey(std::string_view()) {}
+    JsonKey(std::string_view name);
+    JsonKey(const std::string& name) : JsonKey(std::string_view(name)) {}
+    JsonKey(const char* name) : JsonKey(std::string_view(name)) {}
+
+    std::string_view view() const { return text_; }
+    std::string str() const { return std::string(text_); }
+    operator std::string_view() const { return text_; }
+    uint64_t hash() const { return hash_; }
+    bool interned() const { return !owned_; }
+
+    bool equals(std::string_view name, uint64_t hash) const {
+        return hash_ == hash && (text_.data() == name.data() || text_ == name);
+    }
+
+    friend bool operator==(const JsonKey& a, const JsonKey& b) { return a.equals(b.text_, b.hash_); }
+    friend bool operator!=(const JsonKey& a, const JsonKey& b) { return !(a == b); }
+
+    // Comparing with text does not construct (and intern) a key
+    template<typename T, typename = std::enable_if_t<std::is_convertible_v<const T&, std::string_view>>>
+    friend bool operator==(const JsonKey& a, const T& b) { return a.text_ == std::string_view(b); }
+    template<typename T, typename = std::enable_if_t<std::is_convertible_v<const T&, std::string_view>>>
+    friend bool operator==(const T& a, const JsonKey& b) { return b == a; }
+    template<typename T, typename = std::enable_if_t<std::is_convertible_v<const T&, std::string_view>>>
+    friend bool operator!=(const JsonKey& a, const T& b) { return !(a == b); }
+    template<typename T, typename = std::enable_if_t<std::is_convertible_v<const T&, std::string_view>>>
+    friend bool operator!=(const T& a, const JsonKey& b) { return !(b == a); }
+    friend std::ostream& operator<<(std::ostream& out, const JsonKey& key) { return out << key.text_; }
+
+private:
+    std::string_view text_;
+    uint64_t hash_;
+    std::shared_ptr<const std::string> owned_;
+};
+
+/**
+ * @brief JSON object members in insertion order
+ *
+ * Members live in one contiguous vector, so iteration and serialization
+ * follow the order of the input. Small objects are searched linearly by
+ * hash; past INDEX_THRESHOLD members an open-addressing index of positions
+ * is kept alongside. The interface is the subset of std::map that objects
+ * were used through. Keys must not be modified through iterators.
+ */
+class JsonObject {
+public:
+    using key_type = JsonKey;
+    using mapped_type = std::shared_ptr<JsonValue>;
+    using value_type = std::pair<JsonKey, mapped_type>;
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    static constexpr size_t INDEX_THRESHOLD = 16;
+
+    JsonObject() = default;
+
+    /**
+     * @brief Copy of a std::map-based object, in key order
+     */
+    explicit JsonObject(const std::map<std::string, mapped_type>& members);
+
+    iterator begin() { return members_.begin(); }
+    iterator end() { return members_.end(); }
+    const_iterator begin() const { return members_.begin(); }
+    const_iterator end() const { return members_.end(); }
+    size_t size() const { return members_.size(); }
+    bool empty() const { return members_.empty(); }
+    void reserve(size_t count) { members_.reserve(count); }
+    void clear();
+
+    iterator find(std::string_view name);
+    const_iterator find(std::string_view name) const;
+    size_t count(std::string_view name) const { return find(name) != end() ? 1 : 0; }
+    bool contains(std::string_view name) const { return find(name) != end(); }
+
+    /**
+     * @brief Member value; throws std::out_of_range if absent
+     */
+    mapped_type& at(std::string_view name);
+    const mapped_type& at(std::string_view name) const;
+
+    /**
+     * @brief Member value, appended as null pointer if absent
+     */
+    mapped_type& operator[](std::string_view name);
+
+    /**
+     * @brief Append a member unless the name is present
+     * @return The member with that name and whether it was added
+     */
+    std::pair<iterator, bool> emplace(JsonKey name, mapped_type value);
+    std::pair<iterator, bool> insert_or_assign(JsonKey name, mapped_type value);
+
+    /**
+     * @brief Remove a member, keeping the others in order
+     */
+    size_t erase(std::string_view name);
+
+private:
+    std::vector<value_type> members_;
+    std::vector<uint32_t> index_;   // position + 1 per slot, 0 if empty
+
+    size_t locate(std::string_view name, uint64_t hash) const;
+    iterator append(JsonKey&& name, mapped_type&& value);
+    void index_member(size_t position);
+    void rebuild_index();
+};
+
 /**
  * @brief Simple JSON value class with shared ownership
+ *
+ * Numbers written without a fraction or exponent that fit in int64_t keep
+ * their exact integer value alongside the double.
  */
 class JsonValue {
 public:
     JsonValue() : type_(JsonType::Null) {}
     explicit JsonValue(bool val) : type_(JsonType::Boolean), bool_value_(val) {}
     explicit JsonValue(double val) : type_(JsonType::Number), number_value_(val) {}
+    explicit JsonValue(int64_t val)
+        : type_(JsonType::Number), number_value_(static_cast<double>(val)), int_value_(val), integer_(true) {}
+    explicit JsonValue(int val) : JsonValue(static_cast<int64_t>(val)) {}
     explicit JsonValue(const std::string& val) : type_(JsonType::String), string_value_(val) {}
+    explicit JsonValue(const char* val) : type_(JsonType::String), string_value_(val) {}
     
     JsonType type() const { return type_; }
     
+    bool is_null() const { return type_ == JsonType::Null; }
+    bool is_bool() const { return type_ == JsonType::Boolean; }
+    bool is_number() const { return type_ == JsonType::Number; }
+    bool is_integer() const { return type_ == JsonType::Number && integer_; }
+    bool is_string() const { return type_ == JsonType::String; }
+    bool is_array() const { return type_ == JsonType::Array; }
+    bool is_object() const { return type_ == JsonType::Object; }
+
+    // Convenience accessors
+    bool as_bool() const { return bool_value_; }
+    double as_number() const { return number_value_; }
+
+    /**
+     * @brief Exact value for integers, otherwise the double truncated and
+     *        clamped to the int64_t range
+     */
+    int64_t as_int64() const { return integer_ ? int_value_ : detail::saturate_int64(number_value_); }
+    const std::string& as_string() const { return string_value_; }
+    
+    // For arrays and objects, we'll use shared_ptr for simplicity
+    void set_array(std::shared_ptr<std::vector<std::shared_ptr<JsonValue>>> array) {
+        type_ = JsonType::Array;
+        array_value_ = array;
+    }
+    
+    void set_object(std::shared_ptr<JsonObject> object) {
+        type_ = JsonType::Object;
+        object_value_ = std::move(object);
+    }
+
+    /**
+     * @brief Store a copy of a std::map-based object, in key order
+     */
+    void set_object(const std::shared_ptr<std::map<std::string, std::shared_ptr<JsonValue>>>& object) {
+        set_object(object ? std::make_shared<JsonObject>(*object) : nullptr);
+    }
+    
+    std::shared_ptr<std::vector<std::shared_ptr<JsonValue>>> as_array() const {
+        return array_value_;
+    }
+    
+    std::shared_ptr<JsonObject> as_object() const {
+        return object_value_;
+    }
+
+    // Object access helpers
+    std::optional<int> get_int(const std::string& key) const;
+    std::optional<int64_t> get_int64(const std::string& key) const;
+    std::optional<std::string> get_string(const std::string& key) const;
+    std::optional<bool> get_bool(const std::string& key) const;
+    std::optional<double> get_number(const std::string& key) const;
+
+private:
+    JsonType type_;
+    bool bool_value_ = false;
+    double number_value_ = 0.0;
+    int64_t int_value_ = 0;
+    bool integer_ = false;
+    std::string string_value_;
+    std::shared_ptr<std::vector<std::shared_ptr<JsonValue>>> array_value_;
+    std::shared_ptr<JsonObject> object_value_;
+};
+
+/**
+ * @brief JSON parsing functions (forward declared)
+ */
+std::optional<JsonValue> parse_json(std::string_view json);
+std::string serialize_json(const JsonValue& value);
+
+/**
+ * @brief Appends JSON text to a caller-owned buffer
+ *
+ * Only the output is built: there are no temporary strings per value, and
+ * a reused buffer keeps its capacity. Commas and colons are inserted
+ * automatically; keeping the nesting well formed is up to the caller.
+ *
+ * @code
+ * std::string body;
+ * conduit::JsonWriter writer(body);
+ * writer.begin_object().key("id").integer(42).key("tags").begin_array();
+ * writer.string("a").string("b").end_array().end_object();
+ * @endcode
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out) : out_(&out) {}
+
+    JsonWriter& begin_object();
+    JsonWriter& end_object();
+    JsonWriter& begin_array();
+    JsonWriter& end_array();
+    JsonWriter& key(std::string_view name);
+    JsonWriter& string(std::string_view value);
+    JsonWriter& number(double value);
+    JsonWriter& integer(int64_t value);
+    JsonWriter& unsigned_integer(uint64_t value);
+    JsonWriter& boolean(bool value);
+    JsonWriter& null();
+
+    /**
+     * @brief Write a whole JsonValue tree
+     */
+    JsonWriter& value(const JsonValue& value);
+
+    std::string& buffer() { return *out_; }
+
+private:
+    std::string* out_;
+    bool comma_ = false;    // the next value or key needs a separator
+
+    void separate() {
+        if (comma_) out_->push_back(',');
+    }
+    void write_escaped(std::string_view text);
+};
+
+class JsonNode;
+struct JsonMember;
+
+namespace detail {
+    class JsonDocumentParser;
+}
+
+/**
+ * @brief Contiguous, read-only view of array elements or object members
+ */
+template<typename T>
+class JsonRange {
+public:
+    JsonRange(const T* first, size_t count) : first_(first), count_(count) {}
+
+    const T* begin() const { return first_; }
+    const T* end() const { return first_ + count_; }
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    const T& operator[](size_t index) const { return first_[index]; }
+
+private:
+    const T* first_;
+    size_t count_;
+};
+
+/**
+ * @brief Compact JSON value stored in a JsonDocument's arena
+ *
+ * A 16-byte tagged union: the payload is a number, a boolean, or a pointer
+ * to the string bytes, the elements or the members, and the tag carries the
+ * type and length. Children of arrays and objects are stored contiguously.
+ * Nodes are owned by their document and only valid while it lives.
+ */
+class JsonNode {
+public:
+    JsonType type() const { return type_; }
+
     bool is_null() const { return type_ == JsonType::Null; }
     bool is_bool() const { return type_ == JsonType::Boolean; }
     bool is_number() const { return type_ == JsonType::Number; }
@@ -50,86 +374,996 @@ public:
     bool is_array() const { return type_ == JsonType::Array; }
     bool is_object() const { return type_ == JsonType::Object; }
 
-    // Convenience accessors
-    bool as_bool() const { return bool_value_; }
-    double as_number() const { return number_value_; }
-    const std::string& as_string() const { return string_value_; }
-    
-    // For arrays and objects, we'll use shared_ptr for simplicity
-    void set_array(std::shared_ptr<std::vector<std::shared_ptr<JsonValue>>> array) {
-        type_ = JsonType::Array;
-        array_value_ = array;
+    /**
+     * @brief Number written as an integer that fits in int64_t
+     */
+    bool is_integer() const { return is_number() && size_ == INTEGER; }
+
+    bool as_bool() const { return is_bool() && boolean_; }
+    double as_number() const {
+        if (!is_number()) return 0.0;
+        return is_integer() ? static_cast<double>(integer_) : number_;
+    }
+    int64_t as_int64() const {
+        if (!is_number()) return 0;
+        return is_integer() ? integer_ : detail::saturate_int64(number_);
+    }
+    std::string_view as_string() const {
+        return is_string() ? std::string_view(string_, size_) : std::string_view();
+    }
+
+    /**
+     * @brief Number of array elements or object members; 0 for scalars
+     */
+    size_t size() const { return is_array() || is_object() ? size_ : 0; }
+
+    JsonRange<JsonNode> elements() const;
+    JsonRange<JsonMember> members() const;
+
+    /**
+     * @brief Array element; index must be below size()
+     */
+    const JsonNode& operator[](size_t index) const { return elements_[index]; }
+
+    /**
+     * @brief Object member by key, or nullptr; the last duplicate key wins
+     */
+    const JsonNode* find(std::string_view key) const;
+
+    // Object access helpers, as on JsonValue
+    std::optional<int> get_int(std::string_view key) const;
+    std::optional<int64_t> get_int64(std::string_view key) const;
+    std::optional<std::string> get_string(std::string_view key) const;
+    std::optional<bool> get_bool(std::string_view key) const;
+    std::optional<double> get_number(std::string_view key) const;
+
+    /**
+     * @brief Deep copy into the shared_ptr-based JsonValue
+     */
+    JsonValue to_value() const;
+
+private:
+    friend class detail::JsonDocumentParser;
+
+    // For numbers, size_ records which union member is in use
+    static constexpr uint32_t INTEGER = 1;
+
+    union {
+        double number_ = 0.0;
+        int64_t integer_;
+        bool boolean_;
+        const char* string_;
+        const JsonNode* elements_;
+        const JsonMember* members_;
+    };
+    uint32_t size_ = 0;
+    JsonType type_ = JsonType::Null;
+};
+
+/**
+ * @brief Object member: a string key node and its value
+ */
+struct JsonMember {
+    JsonNode key;
+    JsonNode value;
+};
+
+inline JsonRange<JsonNode> JsonNode::elements() const {
+    return JsonRange<JsonNode>(is_array() ? elements_ : nullptr, is_array() ? size_ : 0);
+}
+
+inline JsonRange<JsonMember> JsonNode::members() const {
+    return JsonRange<JsonMember>(is_object() ? members_ : nullptr, is_object() ? size_ : 0);
+}
+
+/**
+ * @brief Parsed JSON held in one monotonic arena
+ *
+ * Every node, string and child array lives in a few large blocks that are
+ * allocated as parsing proceeds and released together when the document is
+ * destroyed, with no per-node allocation or reference counting. Move-only.
+ *
+ * @code
+ * auto doc = conduit::JsonDocument::parse(body);
+ * if (doc) {
+ *     auto id = doc->root().get_int("id");
+ * }
+ * @endcode
+ */
+class JsonDocument {
+public:
+    /**
+     * @brief Parse text; nullopt if it is not a single valid JSON value
+     */
+    static std::optional<JsonDocument> parse(std::string_view json);
+
+    /**
+     * @brief Parse text that will outlive the document, without copying it
+     *
+     * Strings without escapes point into json instead of being copied, and
+     * only escaped strings are decoded into the arena. The caller must keep
+     * json alive and unchanged for as long as the document is used.
+     */
+    static std::optional<JsonDocument> parse_in_place(std::string_view json);
+
+    /**
+     * @brief Replace the contents with json, parsed in place, reusing memory
+     *
+     * The arena keeps its largest block and the parser its scratch buffers,
+     * so parsing a run of similar documents stops allocating after the
+     * first. Earlier nodes become invalid. On failure root() is null.
+     */
+    bool reparse_in_place(std::string_view json);
+
+    JsonDocument(JsonDocument&&) noexcept;
+    JsonDocument& operator=(JsonDocument&&) noexcept;
+    ~JsonDocument();
+
+    const JsonNode& root() const { return *root_; }
+
+    /**
+     * @brief Bytes reserved by the arena
+     */
+    size_t memory_usage() const;
+
+private:
+    friend class detail::JsonDocumentParser;
+    struct Arena;
+
+    JsonDocument();
+    static std::optional<JsonDocument> parse(std::string_view json, bool in_place);
+
+    std::unique_ptr<Arena> arena_;
+    std::unique_ptr<detail::JsonDocumentParser> parser_;    // kept by reparse_in_place
+    const JsonNode* root_ = nullptr;
+};
+
+/**
+ * @brief Read-only cursor that decodes JSON text on demand
+ *
+ * Nothing is parsed up front. Indexing scans the enclosing object or array
+ * for the requested member, stepping over the values it passes by matching
+ * brackets without decoding them, and only the value finally read is
+ * converted. Text is validated only as far as each access looks, so
+ * malformed input shows up as a missing value. A view points into the text
+ * it was created from and is valid only while that text is.
+ *
+ * @code
+ * auto id = response.json_view()["data"]["id"].as_int();
+ * @endcode
+ */
+class JsonView {
+public:
+    /**
+     * @brief A missing value
+     */
+    JsonView() = default;
+
+    /**
+     * @brief View of the value at the start of json, after whitespace
+     */
+    explicit JsonView(std::string_view json);
+
+    bool exists() const { return !text_.empty(); }
+    explicit operator bool() const { return exists(); }
+
+    /**
+     * @brief Type implied by the first byte; Null when missing
+     */
+    JsonType type() const;
+
+    bool is_null() const { return exists() && text_[0] == 'n'; }
+    bool is_bool() const { return exists() && (text_[0] == 't' || text_[0] == 'f'); }
+    bool is_number() const { return type() == JsonType::Number; }
+    bool is_string() const { return exists() && text_[0] == '"'; }
+    bool is_array() const { return exists() && text_[0] == '['; }
+    bool is_object() const { return exists() && text_[0] == '{'; }
+
+    /**
+     * @brief Object member; missing if absent or this is not an object
+     *
+     * Stops at the first matching key rather than reading the whole object.
+     */
+    JsonView operator[](std::string_view key) const;
+
+    /**
+     * @brief Array element; missing if out of range or this is not an array
+     */
+    JsonView operator[](size_t index) const;
+
+    // nullopt when missing, of another type, or malformed
+    std::optional<bool> as_bool() const;
+    std::optional<double> as_number() const;
+    std::optional<int> as_int() const;
+    std::optional<int64_t> as_int64() const;
+    std::optional<std::string> as_string() const;
+
+    /**
+     * @brief Exact text of this value, empty when missing or unterminated
+     */
+    std::string_view raw() const;
+
+    /**
+     * @brief Fully parse this value (and only this value) into a JsonValue
+     */
+    std::optional<JsonValue> to_value() const;
+
+private:
+    struct At {};
+    JsonView(std::string_view text, At) : text_(text) {}
+
+    // From the first byte of the value to the end of the input
+    std::string_view text_;
+};
+
+/**
+ * @brief Receives events from a JsonStreamParser
+ *
+ * Keys and strings arrive fully decoded; the view is only valid for the
+ * duration of the call. Every callback does nothing by default. Throwing
+ * from one stops parsing and propagates out of JsonStreamParser::feed().
+ */
+class JsonHandler {
+public:
+    virtual ~JsonHandler() = default;
+
+    virtual void start_object() {}
+    virtual void end_object() {}
+    virtual void start_array() {}
+    virtual void end_array() {}
+    virtual void key(std::string_view /*name*/) {}
+    virtual void string(std::string_view /*value*/) {}
+    virtual void number(double /*value*/) {}
+
+    /**
+     * @brief Numbers written as integers that fit in int64_t; forwards to
+     *        number() unless overridden
+     */
+    virtual void integer(int64_t value) { number(static_cast<double>(value)); }
+    virtual void boolean(bool /*value*/) {}
+    virtual void null() {}
+};
+
+/**
+ * @brief Resumable, push-style JSON tokenizer
+ *
+ * Bytes can be fed in chunks split anywhere, including inside a string, an
+ * escape or a number; events are emitted as soon as each token is
+ * complete. Memory is bounded by the nesting depth plus the longest string
+ * or number that straddles a chunk boundary. Strings that lie within one
+ * chunk and contain no escapes are passed on without copying.
+ *
+ * @code
+ * conduit::JsonStreamParser parser(handler);
+ * while (size_t n = read_some(buffer)) {
+ *     if (!parser.feed(buffer, n)) break;
+ * }
+ * bool ok = parser.finish();
+ * @endcode
+ */
+class JsonStreamParser {
+public:
+    static constexpr size_t MAX_DEPTH = 1024;
+
+    // Upper bound on one string or number carried across chunks
+    static constexpr size_t MAX_TOKEN_BYTES = 16 * 1024 * 1024;
+
+    explicit JsonStreamParser(JsonHandler& handler) : handler_(&handler) {}
+
+    /**
+     * @brief Consume the next chunk of input
+     * @return false once the input is known to be malformed; further calls
+     *         are ignored until reset()
+     */
+    bool feed(const char* data, size_t size);
+    bool feed(std::string_view data) { return feed(data.data(), data.size()); }
+
+    /**
+     * @brief Signal the end of input
+     * @return true if exactly one complete value was read
+     */
+    bool finish();
+
+    /**
+     * @brief Prepare for another document, keeping allocated buffers
+     */
+    void reset();
+
+    bool failed() const { return state_ == State::Error; }
+    bool complete() const { return state_ == State::Done; }
+
+    /**
+     * @brief Number of objects and arrays currently open
+     */
+    size_t depth() const { return stack_.size(); }
+
+    /**
+     * @brief Bytes consumed; after a failure, the offset of the bad byte
+     */
+    size_t offset() const { return offset_; }
+
+private:
+    enum class State : uint8_t {
+        Value,          // a value must follow
+        ArrayOpen,      // a value or ']'
+        ObjectOpen,     // a key or '}'
+        Key,            // a key after ','
+        Colon,
+        AfterValue,     // ',' or a closing bracket
+        String,
+        Escape,
+        Unicode,
+        Number,
+        Literal,
+        Done,
+        Error
+    };
+
+    JsonHandler* handler_;
+    State state_ = State::Value;
+    std::string stack_;         // '{' or '[' per open container
+    std::string token_;         // string or number bytes carried across chunks
+    const char* literal_ = nullptr;
+    size_t literal_matched_ = 0;
+    bool in_key_ = false;
+    uint32_t code_unit_ = 0;
+    int hex_digits_ = 0;
+    uint32_t high_surrogate_ = 0;
+    size_t offset_ = 0;
+
+    bool structural(char c);
+    bool start_value(char c);
+    void value_done() { state_ = stack_.empty() ? State::Done : State::AfterValue; }
+    size_t scan_string(const char* data, size_t size, size_t i);
+    size_t scan_number(const char* data, size_t size, size_t i);
+    bool escape(char c);
+    bool unicode_digit(char c);
+    bool end_number();
+    void flush_surrogate();
+    void append_utf8(uint32_t code_point);
+};
+
+/**
+ * @brief Splits newline-delimited JSON (NDJSON, JSON Lines) into records
+ *
+ * Bytes can be fed in chunks split anywhere. Each complete line is parsed
+ * and handed to the handler as a JsonNode that is valid only during the
+ * call. Lines that fit in one chunk are parsed where they lie; only a line
+ * that straddles chunks is copied, and never beyond max_line_bytes. One
+ * JsonDocument is reparsed for every record, so after the first few the
+ * parser no longer allocates. Blank lines are skipped.
+ *
+ * @code
+ * conduit::JsonLinesParser parser([](const conduit::JsonNode& record) {
+ *     std::cout << record.get_string("level").value_or("?") << std::endl;
+ *     return true;    // false stops
+ * });
+ * parser.feed(chunk);
+ * parser.finish();
+ * @endcode
+ */
+class JsonLinesParser {
+public:
+    using RecordHandler = std::function<bool(const JsonNode& record)>;
+
+    static constexpr size_t DEFAULT_MAX_LINE_BYTES = 1024 * 1024;
+
+    explicit JsonLinesParser(RecordHandler handler, size_t max_line_bytes = DEFAULT_MAX_LINE_BYTES)
+        : handler_(std::move(handler)), max_line_bytes_(max_line_bytes) {}
+
+    /**
+     * @brief Consume the next chunk, delivering every line it completes
+     * @return false once a line is malformed or too long, or the handler
+     *         returned false; further input is ignored until reset()
+     */
+    bool feed(const char* data, size_t size);
+    bool feed(std::string_view data) { return feed(data.data(), data.size()); }
+
+    /**
+     * @brief Signal the end of input, delivering a final unterminated line
+     * @return false if that line is malformed or parsing had already failed
+     */
+    bool finish();
+
+    /**
+     * @brief Prepare for another stream, keeping allocated buffers
+     */
+    void reset();
+
+    bool failed() const { return state_ == State::Failed; }
+    bool stopped() const { return state_ == State::Stopped; }
+
+    /**
+     * @brief Records delivered so far
+     */
+    size_t records() const { return records_; }
+
+    /**
+     * @brief 1-based number of the line being read; after a failure, the bad one
+     */
+    size_t line() const { return line_number_; }
+
+private:
+    enum class State : uint8_t { Running, Stopped, Failed };
+
+    RecordHandler handler_;
+    size_t max_line_bytes_;
+    State state_ = State::Running;
+    std::string partial_;                   // a line carried across chunks
+    std::optional<JsonDocument> document_;  // reused for every record
+    size_t records_ = 0;
+    size_t line_number_ = 1;
+
+    bool deliver(std::string_view line);
+};
+
+/**
+ * @brief Pull reader that decodes JSON text straight into C++ values
+ *
+ * Used by the JsonBinding specializations behind from_json() and
+ * Response::as<T>(). Values are read in document order, objects one key at
+ * a time, and nothing is stored but the values themselves. Skipped values
+ * are stepped over without being checked. Each read returns false and
+ * marks the reader failed on malformed input or a type mismatch.
+ */
+class JsonReader {
+public:
+    explicit JsonReader(std::string_view json) : text_(json) {}
+
+    bool failed() const { return failed_; }
+
+    /**
+     * @brief Mark the input as rejected; for bindings of user types
+     */
+    bool fail() {
+        failed_ = true;
+        return false;
+    }
+
+    /**
+     * @brief True if nothing failed and only whitespace remains
+     */
+    bool finish();
+
+    /**
+     * @brief Consume a null if one is next
+     */
+    bool read_null();
+
+    bool read(bool& value);
+    bool read(int64_t& value);      // integers, or doubles with an exact integral value
+    bool read(uint64_t& value);     // the same, non-negative and up to UINT64_MAX
+    bool read(double& value);
+    bool read(std::string& value);
+
+    /**
+     * @brief Enter an object; then call next_key() until it returns false
+     */
+    bool begin_object();
+
+    /**
+     * @brief Advance to the next member, whose value must be read or skipped
+     * @param key Decoded name, valid until the next call
+     * @return false at the closing brace or on error
+     */
+    bool next_key(std::string_view& key);
+
+    /**
+     * @brief Enter an array; then call next_element() until it returns false
+     */
+    bool begin_array();
+    bool next_element();
+
+    /**
+     * @brief Step over the next value
+     */
+    bool skip();
+
+private:
+    std::string_view text_;
+    size_t pos_ = 0;
+    bool failed_ = false;
+    bool first_ = false;        // no separator is due before the next member
+    std::string scratch_;       // keys that needed unescaping
+
+    bool expect(char c);
+    std::string_view scalar();
+};
+
+/**
+ * @brief How a type is read from and written to JSON
+ *
+ * Provided for bool, arithmetic types, std::string, std::optional,
+ * std::vector, std::map with string keys, and structs listed with
+ * CONDUIT_JSON_FIELDS. Specialize it to support other types:
+ *
+ * @code
+ * template <> struct conduit::JsonBinding<Color> {
+ *     static bool read(JsonReader& reader, Color& value);
+ *     static void write(JsonWriter& writer, const Color& value);
+ * };
+ * @endcode
+ */
+template<typename T, typename Enable = void>
+struct JsonBinding;
+
+template<typename T>
+bool read_json(JsonReader& reader, T& value) {
+    return JsonBinding<T>::read(reader, value);
+}
+
+template<typename T>
+void write_json(JsonWriter& writer, const T& value) {
+    JsonBinding<T>::write(writer, value);
+}
+
+/**
+ * @brief Parse text directly into a T, with no intermediate JsonValue
+ * @return nullopt if the text is malformed or does not match T
+ */
+template<typename T>
+std::optional<T> from_json(std::string_view json) {
+    T value{};
+    JsonReader reader(json);
+    if (!read_json(reader, value) || !reader.finish()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+template<typename T>
+std::string to_json(const T& value) {
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer, value);
+    return out;
+}
+
+namespace detail {
+    template<typename Class, typename Member>
+    struct JsonField {
+        std::string_view name;
+        uint64_t hash;
+        Member Class::* member;
+    };
+
+    template<typename Class, typename Member>
+    constexpr JsonField<Class, Member> json_field(std::string_view name, Member Class::* member) {
+        return JsonField<Class, Member>{name, json_key_hash(name), member};
+    }
+
+    // Found by argument-dependent lookup in the namespace of T
+    template<typename T>
+    using json_fields_t = decltype(conduit_json_fields(std::declval<const T*>()));
+
+    template<typename T, typename = void>
+    struct has_json_fields : std::false_type {};
+
+    template<typename T>
+    struct has_json_fields<T, std::void_t<json_fields_t<T>>> : std::true_type {};
+
+    template<typename T, typename = void>
+    struct is_json_bindable : std::false_type {};
+
+    template<typename T>
+    struct is_json_bindable<T, std::void_t<decltype(JsonBinding<T>::write(
+        std::declval<JsonWriter&>(), std::declval<const T&>()))>> : std::true_type {};
+} // namespace detail
+
+template<>
+struct JsonBinding<bool> {
+    static bool read(JsonReader& reader, bool& value) { return reader.read(value); }
+    static void write(JsonWriter& writer, bool value) { writer.boolean(value); }
+};
+
+template<typename T>
+struct JsonBinding<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>> {
+    // Unsigned types go through uint64_t so values above INT64_MAX survive
+    using Wide = std::conditional_t<std::is_unsigned_v<T>, uint64_t, int64_t>;
+
+    static bool read(JsonReader& reader, T& value) {
+        Wide number;
+        if (!reader.read(number)) {
+            return false;
+        }
+        if (number < std::numeric_limits<T>::min() || number > std::numeric_limits<T>::max()) {
+            return reader.fail();
+        }
+        value = static_cast<T>(number);
+        return true;
+    }
+    static void write(JsonWriter& writer, T value) {
+        if constexpr (std::is_unsigned_v<T>) {
+            writer.unsigned_integer(value);
+        } else {
+            writer.integer(value);
+        }
+    }
+};
+
+template<typename T>
+struct JsonBinding<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+    static bool read(JsonReader& reader, T& value) {
+        double number;
+        if (!reader.read(number)) {
+            return false;
+        }
+        value = static_cast<T>(number);
+        return true;
     }
-    
-    void set_object(std::shared_ptr<std::map<std::string, std::shared_ptr<JsonValue>>> object) {
-        type_ = JsonType::Object;
-        object_value_ = object;
+    static void write(JsonWriter& writer, T value) { writer.number(static_cast<double>(value)); }
+};
+
+template<>
+struct JsonBinding<std::string> {
+    static bool read(JsonReader& reader, std::string& value) { return reader.read(value); }
+    static void write(JsonWriter& writer, const std::string& value) { writer.string(value); }
+};
+
+template<typename T>
+struct JsonBinding<std::optional<T>> {
+    static bool read(JsonReader& reader, std::optional<T>& value) {
+        if (reader.read_null()) {
+            value.reset();
+            return true;
+        }
+        return read_json(reader, value.emplace());
     }
-    
-    std::shared_ptr<std::vector<std::shared_ptr<JsonValue>>> as_array() const {
-        return array_value_;
+    static void write(JsonWriter& writer, const std::optional<T>& value) {
+        if (value) {
+            write_json(writer, *value);
+        } else {
+            writer.null();
+        }
     }
-    
-    std::shared_ptr<std::map<std::string, std::shared_ptr<JsonValue>>> as_object() const {
-        return object_value_;
+};
+
+template<typename T>
+struct JsonBinding<std::vector<T>> {
+    static bool read(JsonReader& reader, std::vector<T>& value) {
+        value.clear();
+        if (!reader.begin_array()) {
+            return false;
+        }
+        while (reader.next_element()) {
+            if (!read_json(reader, value.emplace_back())) {
+                return false;
+            }
+        }
+        return !reader.failed();
     }
+    static void write(JsonWriter& writer, const std::vector<T>& value) {
+        writer.begin_array();
+        for (const auto& element : value) {
+            write_json(writer, element);
+        }
+        writer.end_array();
+    }
+};
 
-    // Object access helpers
-    std::optional<int> get_int(const std::string& key) const;
-    std::optional<std::string> get_string(const std::string& key) const;
-    std::optional<bool> get_bool(const std::string& key) const;
-    std::optional<double> get_number(const std::string& key) const;
+template<typename T>
+struct JsonBinding<std::map<std::string, T>> {
+    static bool read(JsonReader& reader, std::map<std::string, T>& value) {
+        value.clear();
+        if (!reader.begin_object()) {
+            return false;
+        }
+        std::string_view key;
+        while (reader.next_key(key)) {
+            if (!read_json(reader, value[std::string(key)])) {
+                return false;
+            }
+        }
+        return !reader.failed();
+    }
+    static void write(JsonWriter& writer, const std::map<std::string, T>& value) {
+        writer.begin_object();
+        for (const auto& [key, element] : value) {
+            writer.key(key);
+            write_json(writer, element);
+        }
+        writer.end_object();
+    }
+};
 
-private:
-    JsonType type_;
-    bool bool_value_ = false;
-    double number_value_ = 0.0;
-    std::string string_value_;
-    std::shared_ptr<std::vector<std::shared_ptr<JsonValue>>> array_value_;
-    std::shared_ptr<std::map<std::string, std::shared_ptr<JsonValue>>> object_value_;
+/**
+ * @brief Structs described with CONDUIT_JSON_FIELDS
+ *
+ * A key is matched by comparing its hash with hashes computed at compile
+ * time, then comparing the name itself. Unknown keys are skipped and
+ * absent members keep their default values.
+ */
+template<typename T>
+struct JsonBinding<T, std::enable_if_t<detail::has_json_fields<T>::value>> {
+    static bool read(JsonReader& reader, T& value) {
+        constexpr auto fields = conduit_json_fields(static_cast<const T*>(nullptr));
+        if (!reader.begin_object()) {
+            return false;
+        }
+        std::string_view key;
+        while (reader.next_key(key)) {
+            uint64_t hash = detail::json_key_hash(key);
+            bool matched = false;
+            bool ok = true;
+            std::apply([&](const auto&... field) {
+                ((!matched && field.hash == hash && field.name == key &&
+                  (matched = true, ok = read_json(reader, value.*field.member))) || ...);
+            }, fields);
+            if (!ok || (!matched && !reader.skip())) {
+                return false;
+            }
+        }
+        return !reader.failed();
+    }
+
+    static void write(JsonWriter& writer, const T& value) {
+        constexpr auto fields = conduit_json_fields(static_cast<const T*>(nullptr));
+        writer.begin_object();
+        std::apply([&](const auto&... field) {
+            ((writer.key(field.name), write_json(writer, value.*field.member)), ...);
+        }, fields);
+        writer.end_object();
+    }
 };
 
+namespace detail {
+    /**
+     * @brief 32-bit FNV-1a over the ASCII-lowercased name
+     */
+    constexpr uint32_t header_hash(std::string_view name) {
+        uint32_t hash = 2166136261u;
+        for (char c : name) {
+            char lower = (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+            hash = (hash ^ static_cast<unsigned char>(lower)) * 16777619u;
+        }
+        return hash;
+    }
+} // namespace detail
+
 /**
- * @brief JSON parsing functions (forward declared)
+ * @brief A header field name with its case-insensitive hash
+ *
+ * Converts implicitly from strings, hashing at the call. The constants in
+ * conduit::header are hashed at compile time.
  */
-std::optional<JsonValue> parse_json(const std::string& json_string);
-std::string serialize_json(const JsonValue& value);
+struct HeaderName {
+    std::string_view name;
+    uint32_t hash;
+
+    constexpr HeaderName(std::string_view text) : name(text), hash(detail::header_hash(text)) {}
+    constexpr HeaderName(const char* text) : HeaderName(std::string_view(text)) {}
+    HeaderName(const std::string& text) : HeaderName(std::string_view(text)) {}
+
+    /**
+     * @brief Same name, ignoring ASCII case
+     */
+    bool equals(const HeaderName& other) const;
+};
+
+/**
+ * @brief Well-known header names
+ */
+namespace header {
+    inline constexpr HeaderName accept{"Accept"};
+    inline constexpr HeaderName authorization{"Authorization"};
+    inline constexpr HeaderName cache_control{"Cache-Control"};
+    inline constexpr HeaderName connection{"Connection"};
+    inline constexpr HeaderName content_encoding{"Content-Encoding"};
+    inline constexpr HeaderName content_length{"Content-Length"};
+    inline constexpr HeaderName content_type{"Content-Type"};
+    inline constexpr HeaderName cookie{"Cookie"};
+    inline constexpr HeaderName date{"Date"};
+    inline constexpr HeaderName etag{"ETag"};
+    inline constexpr HeaderName host{"Host"};
+    inline constexpr HeaderName location{"Location"};
+    inline constexpr HeaderName retry_after{"Retry-After"};
+    inline constexpr HeaderName server{"Server"};
+    inline constexpr HeaderName set_cookie{"Set-Cookie"};
+    inline constexpr HeaderName transfer_encoding{"Transfer-Encoding"};
+    inline constexpr HeaderName user_agent{"User-Agent"};
+} // namespace header
+
+/**
+ * @brief Header fields in order, looked up without regard to case
+ *
+ * All fields live in one block the map owns, in wire format
+ * ("Name: value\r\n" each), and are handed out as views into it. Each field
+ * costs one append to the block and one 16-byte entry; the first
+ * INLINE_FIELDS entries are stored in the map itself. Repeated fields such
+ * as Set-Cookie are all kept: get() returns the last, as the std::map it
+ * replaces did, and get_all() every one.
+ * Views stay valid until the map is modified, moved or destroyed.
+ */
+class HeaderMap {
+public:
+    static constexpr size_t INLINE_FIELDS = 16;
+
+    struct Field {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Field;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Field;
+
+        const_iterator(const HeaderMap* map, size_t index) : map_(map), index_(index) {}
+
+        Field operator*() const { return map_->field(index_); }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++index_; return old; }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+
+    private:
+        const HeaderMap* map_;
+        size_t index_;
+    };
+
+    HeaderMap() = default;
+    HeaderMap(std::initializer_list<std::pair<std::string_view, std::string_view>> fields);
+    HeaderMap(const std::map<std::string, std::string>& fields);
+
+    HeaderMap(const HeaderMap&) = default;
+    HeaderMap& operator=(const HeaderMap&) = default;
+    HeaderMap(HeaderMap&& other) noexcept;
+    HeaderMap& operator=(HeaderMap&& other) noexcept;
+
+    /**
+     * @brief Append a field, keeping any earlier ones of the same name
+     */
+    void add(const HeaderName& name, std::string_view value);
+
+    /**
+     * @brief Value of the last field with this name
+     */
+    std::optional<std::string_view> get(const HeaderName& name) const;
+
+    /**
+     * @brief Values of every field with this name, in order
+     */
+    std::vector<std::string_view> get_all(const HeaderName& name) const;
+
+    size_t count(const HeaderName& name) const;
+    bool contains(const HeaderName& name) const { return find(name) < size_; }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+
+    /**
+     * @brief Every field in wire format, ready to go in a request
+     */
+    const std::string& block() const { return block_; }
+
+    /**
+     * @brief Remove every field, keeping the capacity
+     */
+    void clear();
+
+private:
+    struct Entry {
+        uint32_t offset;        // of the name in block_; the value follows ": "
+        uint32_t name_size;
+        uint32_t value_size;
+        uint32_t hash;
+    };
+
+    std::string block_;
+    Entry inline_[INLINE_FIELDS] = {};
+    std::vector<Entry> overflow_;
+    size_t size_ = 0;
+
+    const Entry& entry(size_t index) const {
+        return index < INLINE_FIELDS ? inline_[index] : overflow_[index - INLINE_FIELDS];
+    }
+
+    Field field(size_t index) const {
+        const Entry& e = entry(index);
+        std::string_view block(block_);
+        return Field{block.substr(e.offset, e.name_size), block.substr(e.offset + e.name_size + 2, e.value_size)};
+    }
+
+    /**
+     * @brief Index of the first field named name, size() if none
+     */
+    size_t find(const HeaderName& name, size_t from = 0) const;
+};
 
 /**
  * @brief HTTP response representation
  */
 class Response {
 public:
-    Response(int status_code, std::string body, std::map<std::string, std::string> headers)
+    Response(int status_code, std::string body, HeaderMap headers)
         : status_code_(status_code), body_(std::move(body)), headers_(std::move(headers)) {
-        
-        // Parse JSON if content type indicates JSON
-        auto content_type = get_header("Content-Type");
-        if (content_type && content_type->find("application/json") != std::string::npos) {
-            json_ = parse_json(body_);
+        if (is_json()) {
+            json_ = std::make_shared<JsonCache>();
         }
     }
 
     int status_code() const { return status_code_; }
     const std::string& body() const { return body_; }
-    const std::map<std::string, std::string>& headers() const { return headers_; }
-    const std::optional<JsonValue>& json() const { return json_; }
+    const HeaderMap& headers() const { return headers_; }
+
+    /**
+     * @brief Body parsed as a JsonValue, if Content-Type is application/json
+     *
+     * Parsed on the first call and cached; safe to call from several
+     * threads at once. Copies of a Response share the cache.
+     */
+    const std::optional<JsonValue>& json() const {
+        static const std::optional<JsonValue> none;
+        if (!json_) {
+            return none;
+        }
+        std::call_once(json_->once, [this] { json_->value = parse_json(body_); });
+        return json_->value;
+    }
+
+    /**
+     * @brief On-demand cursor over a JSON body, without building a DOM
+     *
+     * Missing if Content-Type is not application/json. The view refers to
+     * body(), so it must not outlive this Response.
+     */
+    JsonView json_view() const {
+        return is_json() ? JsonView(body_) : JsonView();
+    }
+
+    /**
+     * @brief Body parsed into a JsonDocument whose strings point into body()
+     *
+     * nullopt if Content-Type is not application/json or the body is
+     * malformed. Not cached; the document must not outlive this Response.
+     */
+    std::optional<JsonDocument> json_document() const {
+        return is_json() ? JsonDocument::parse_in_place(body_) : std::nullopt;
+    }
+
+    /**
+     * @brief Parse the body straight into a type with a JsonBinding
+     *
+     * Throws ResponseException if the body is not JSON of that shape.
+     */
+    template<typename T>
+    T as() const;
 
-    std::optional<std::string> get_header(const std::string& name) const {
-        auto it = headers_.find(name);
-        return it != headers_.end() ? std::optional<std::string>(it->second) : std::nullopt;
+    /**
+     * @brief Value of a header, whatever the case of its name
+     *
+     * The last one if it is repeated; see headers().get_all().
+     */
+    std::optional<std::string> get_header(const HeaderName& name) const {
+        auto value = headers_.get(name);
+        return value ? std::optional<std::string>(*value) : std::nullopt;
     }
 
     std::string content_type() const {
-        auto ct = get_header("Content-Type");
-        return ct ? *ct : "";
+        return std::string(headers_.get(header::content_type).value_or(std::string_view()));
     }
 
 private:
     int status_code_;
     std::string body_;
-    std::map<std::string, std::string> headers_;
-    std::optional<JsonValue> json_;
+    HeaderMap headers_;
+
+    struct JsonCache {
+        std::once_flag once;
+        std::optional<JsonValue> value;
+    };
+    std::shared_ptr<JsonCache> json_;   // only for JSON bodies
+
+    bool is_json() const {
+        auto content_type = headers_.get(header::content_type);
+        return content_type && content_type->find("application/json") != std::string_view::npos;
+    }
 };
 
 /**
@@ -159,6 +1393,33 @@ public:
     explicit ResponseException(const std::string& message) : HttpException("Response error: " + message) {}
 };
 
+class TimeoutException : public HttpException {
+public:
+    explicit TimeoutException(const std::string& message) : HttpException("Timeout error: " + message) {}
+};
+
+class CancelledException : public HttpException {
+public:
+    explicit CancelledException(const std::string& message) : HttpException("Request cancelled: " + message) {}
+};
+
+template<typename T>
+T Response::as() const {
+    auto value = from_json<T>(body_);
+    if (!value) {
+        throw ResponseException("Body does not match the requested type");
+    }
+    return std::move(*value);
+}
+
+/**
+ * @brief Socket I/O mechanism used by EventLoop
+ */
+enum class IoBackendType {
+    Epoll,
+    IoUring     // Falls back to Epoll when the kernel lacks support
+};
+
 /**
  * @brief HTTP client configuration
  */
@@ -167,12 +1428,63 @@ struct ClientConfig {
     std::map<std::string, std::string> default_headers;
     bool verify_ssl{true};
     std::optional<std::string> user_agent;
+
+    // Keep-alive pool used by the HttpClient convenience methods
+    size_t max_idle_connections{32};
+    size_t max_idle_per_host{4};
+    std::chrono::seconds idle_timeout{60};
+
+    // I/O backend for an EventLoop constructed from this configuration
+    IoBackendType io_backend{IoBackendType::Epoll};
+
+    // DNS: how long answers (and failures) stay in the shared cache, and
+    // /etc/hosts-style overrides mapping a host name to literal addresses
+    std::chrono::seconds dns_ttl{60};
+    std::chrono::seconds dns_negative_ttl{5};
+    std::map<std::string, std::vector<std::string>> host_overrides;
+
+    // Connecting: deadline for establishing the TCP connection, separate
+    // from timeout, and the head start each address gets before the next
+    // one is tried in parallel (Happy Eyeballs, RFC 8305)
+    std::chrono::milliseconds connect_timeout{10000};
+    std::chrono::milliseconds connection_attempt_delay{250};
+
+    // Most requests Connection::pipeline() writes before reading responses
+    size_t pipeline_depth{8};
     
     ClientConfig() {
         default_headers["User-Agent"] = "Conduit-CPP/1.0";
     }
 };
 
+/**
+ * @brief Callbacks for consuming a response body as it arrives
+ *
+ * on_headers runs once, after the status line and headers are parsed and
+ * before any body bytes are delivered. on_data then receives the decoded
+ * body (chunk framing removed) in the pieces recv() produced; the pointer
+ * is only valid for the duration of the call. Throwing from either
+ * callback aborts the request and closes the connection.
+ */
+struct StreamHandler {
+    std::function<void(int status_code, const HeaderMap& headers)> on_headers;
+    std::function<void(const char* data, size_t size)> on_data;
+};
+
+/**
+ * @brief One request of a batch sent with Connection::pipeline()
+ */
+struct PipelinedRequest {
+    std::string method = "GET";
+    std::string path;
+    std::string body;
+    HeaderMap headers;
+};
+
+class ConnectionPool;
+class RequestTemplate;
+class FormBody;
+
 /**
  * @brief Main HTTP client class
  */
@@ -184,8 +1496,8 @@ public:
     // Non-copyable but movable
     HttpClient(const HttpClient&) = delete;
     HttpClient& operator=(const HttpClient&) = delete;
-    HttpClient(HttpClient&&) = default;
-    HttpClient& operator=(HttpClient&&) = default;
+    HttpClient(HttpClient&&) noexcept;
+    HttpClient& operator=(HttpClient&&) noexcept;
 
     /**
      * @brief Connection class for persistent connections
@@ -198,27 +1510,136 @@ public:
         // Non-copyable but movable
         Connection(const Connection&) = delete;
         Connection& operator=(const Connection&) = delete;
-        Connection(Connection&&) = default;
-        Connection& operator=(Connection&&) = default;
+        Connection(Connection&& other) noexcept;
+        Connection& operator=(Connection&& other) noexcept;
 
-        Response get(const std::string& path, const std::map<std::string, std::string>& headers = {});
+        Response get(const std::string& path, const HeaderMap& headers = {});
         Response post(const std::string& path, const std::string& body, 
                      const std::string& content_type = "application/json",
-                     const std::map<std::string, std::string>& headers = {});
+                     const HeaderMap& headers = {});
         Response post_json(const std::string& path, const JsonValue& json,
-                          const std::map<std::string, std::string>& headers = {});
+                          const HeaderMap& headers = {});
+        Response post_form(const std::string& path, const FormBody& form,
+                          const HeaderMap& headers = {});
+
+        /**
+         * @brief POST any type with a JsonBinding, serialized without a JsonValue
+         */
+        template<typename T, typename = std::enable_if_t<detail::is_json_bindable<T>::value>>
+        Response post_json(const std::string& path, const T& value,
+                          const HeaderMap& headers = {}) {
+            tx_body_.clear();
+            JsonWriter writer(tx_body_);
+            write_json(writer, value);
+            return post_tx_body(path, headers);
+        }
+
+        /**
+         * @brief GET with the body streamed to a handler instead of buffered
+         * @return Status and headers; the body is left empty
+         */
+        Response get_stream(const std::string& path, const StreamHandler& handler,
+                            const HeaderMap& headers = {});
+        Response get_stream(const std::string& path, std::ostream& out,
+                            const HeaderMap& headers = {});
+
+        /**
+         * @brief GET with a JSON body parsed into events as it is received
+         *
+         * Parsing overlaps the transfer and the body is never held in full.
+         * Bodies whose Content-Type is not JSON are skipped without calling
+         * the handler; check status_code(). Throws ResponseException if a
+         * JSON body is malformed or truncated.
+         */
+        Response get_stream(const std::string& path, JsonHandler& handler,
+                            const HeaderMap& headers = {});
+
+        /**
+         * @brief GET a newline-delimited JSON body one record at a time
+         *
+         * Each line is parsed and delivered as soon as it has arrived, so
+         * feeds that never end can be consumed. Memory is bounded by
+         * max_line_bytes. Returning false from the handler ends the request
+         * and closes the connection. Bodies whose Content-Type is not JSON
+         * are skipped. Throws ResponseException on a malformed or overlong
+         * line.
+         */
+        Response get_json_lines(const std::string& path, const JsonLinesParser::RecordHandler& on_record,
+                                const HeaderMap& headers = {},
+                                size_t max_line_bytes = JsonLinesParser::DEFAULT_MAX_LINE_BYTES);
+
+        /**
+         * @brief Send any request and stream its response body to a handler
+         */
+        Response stream_request(const std::string& method, const std::string& path,
+                                const std::string& body, const StreamHandler& handler,
+                                const HeaderMap& headers = {});
+
+        /**
+         * @brief Send requests back to back and read the responses in order
+         *
+         * Up to ClientConfig::pipeline_depth requests go out in one writev
+         * before their responses are read; a request that is not idempotent
+         * ends the batch it is in. If the server closes the connection,
+         * the unanswered requests are resent one at a time on a new one,
+         * except that a request that is not idempotent is never resent
+         * after a connection dropped without warning: the
+         * ConnectionException propagates instead.
+         * @return One response per request, in request order
+         */
+        std::vector<Response> pipeline(const std::vector<PipelinedRequest>& requests);
+
+        /**
+         * @brief Render a request for this host once, to be sent many times
+         *
+         * path_pattern may contain slots written as {name}, e.g.
+         * "/users/{id}/orders", filled in by send(). The request line, Host,
+         * the default headers and headers are formatted here, so send()
+         * only fills the slots and adds Content-Length. Throws
+         * RequestException on an unterminated or empty slot.
+         */
+        RequestTemplate prepare(const std::string& method, const std::string& path_pattern,
+                                const HeaderMap& headers = {}) const;
+
+        /**
+         * @brief Send a prepared request with its slots filled in order
+         *
+         * Slot values are inserted verbatim, so they must already be
+         * percent-encoded. Throws RequestException if the number of values
+         * does not match, a value contains a space or control character, or
+         * the template was prepared for another host.
+         */
+        Response send(const RequestTemplate& request, std::initializer_list<std::string_view> slots = {},
+                      std::string_view body = {});
+
+        bool is_connected() const { return connected_; }
 
     private:
+        friend class ConnectionPool;
+
         std::string hostname_;
         int port_;
         ClientConfig config_;
         int socket_fd_;
         bool connected_;
+        bool keep_alive_ = true;
+        std::chrono::steady_clock::time_point last_used_;
+        std::vector<char> rx_buffer_;
+        size_t rx_begin_ = 0;
+        size_t rx_end_ = 0;
+        std::string tx_body_;       // reused by post_json
+        std::string tx_head_;       // reused by send
+        HeaderMap default_headers_;     // config_.default_headers, rendered once
         
         void connect();
         void disconnect();
+        bool is_reusable() const;
+        size_t fill_receive_buffer();
+        Response receive_response(bool head_request, const StreamHandler* stream);
+        Response post_tx_body(const std::string& path, const HeaderMap& headers);
         Response send_request(const std::string& method, const std::string& path,
-                             const std::string& body, const std::map<std::string, std::string>& headers);
+                             const std::string& body, const HeaderMap& headers,
+                             const StreamHandler* stream = nullptr, std::string_view content_type = {});
     };
 
     /**
@@ -229,30 +1650,289 @@ public:
     /**
      * @brief Convenience methods for one-off requests
      */
-    Response get(const std::string& url, const std::map<std::string, std::string>& headers = {});
+    Response get(const std::string& url, const HeaderMap& headers = {});
     Response post(const std::string& url, const std::string& body,
                  const std::string& content_type = "application/json",
-                 const std::map<std::string, std::string>& headers = {});
+                 const HeaderMap& headers = {});
     Response post_json(const std::string& url, const JsonValue& json,
-                      const std::map<std::string, std::string>& headers = {});
+                      const HeaderMap& headers = {});
+    Response post_form(const std::string& url, const FormBody& form,
+                      const HeaderMap& headers = {});
+
+    template<typename T, typename = std::enable_if_t<detail::is_json_bindable<T>::value>>
+    Response post_json(const std::string& url, const T& value,
+                      const HeaderMap& headers = {}) {
+        return post(url, to_json(value), "application/json", headers);
+    }
+
+    /**
+     * @brief One-off GET with the body streamed instead of buffered
+     */
+    Response get_stream(const std::string& url, const StreamHandler& handler,
+                        const HeaderMap& headers = {});
+    Response get_stream(const std::string& url, std::ostream& out,
+                        const HeaderMap& headers = {});
+    Response get_stream(const std::string& url, JsonHandler& handler,
+                        const HeaderMap& headers = {});
+    Response get_json_lines(const std::string& url, const JsonLinesParser::RecordHandler& on_record,
+                            const HeaderMap& headers = {},
+                            size_t max_line_bytes = JsonLinesParser::DEFAULT_MAX_LINE_BYTES);
+
+    /**
+     * @brief Number of idle keep-alive connections held by the pool
+     */
+    size_t idle_connections() const;
+
+    /**
+     * @brief Close every idle pooled connection
+     */
+    void clear_idle_connections();
 
 private:
     ClientConfig config_;
+    std::unique_ptr<ConnectionPool> pool_;
+
+    template <typename RequestFn>
+    Response send_pooled(const std::string& method, const std::string& host, int port, RequestFn&& request);
+};
+
+/**
+ * @brief A request rendered once by HttpClient::Connection::prepare()
+ *
+ * Holds the request head split around its path slots. It refers to
+ * nothing in the connection, so it can be kept for as long as needed and
+ * sent from any connection to the same host.
+ */
+class RequestTemplate {
+public:
+    const std::string& method() const { return method_; }
+    const std::string& hostname() const { return hostname_; }
+
+    /**
+     * @brief Slot names in the order send() expects their values
+     */
+    const std::vector<std::string>& slots() const { return slots_; }
+
+    /**
+     * @brief Write the request head for these slot values into out
+     *
+     * Everything but the body: out is replaced, keeping its capacity.
+     * Throws RequestException as HttpClient::Connection::send() does.
+     */
+    void render_head(std::initializer_list<std::string_view> slots, size_t body_size, std::string& out) const;
+
+private:
+    friend class HttpClient::Connection;
+
+    std::string method_;
+    std::string hostname_;
+    std::vector<std::string> slots_;
+    std::vector<std::string> segments_;  // request line around the slots; one more than slots_
+    std::string tail_;                   // " HTTP/1.1", Host and the headers, without the blank line
 };
 
 /**
  * @brief URL parsing utilities
  */
 struct ParsedUrl {
-    std::string scheme;
-    std::string host;
+    std::string scheme;     // lower case
+    std::string host;       // percent-decoded; IPv6 literals without brackets
     int port;
     std::string path;
     std::string query;
+    std::string userinfo;
+    std::string fragment;   // never sent
+
+    /**
+     * @brief Path and query as they go in the request line
+     */
+    std::string target() const;
 };
 
+/**
+ * @brief Parse an http or https URL
+ *
+ * Hosts may be IPv6 literals in brackets. Scheme and authority come from a
+ * small cache of recently parsed base URLs shared by all threads, so
+ * repeated requests to one host only scan the path and query. Throws
+ * std::invalid_argument for anything else.
+ */
 ParsedUrl parse_url(const std::string& url);
 
+/**
+ * @brief The components of an absolute URL, as views into it
+ *
+ * Components are left percent-encoded and without their delimiters; an
+ * IPv6 host keeps its brackets. port is the explicit port or, for http
+ * and https, the default one, and -1 otherwise.
+ */
+struct UrlView {
+    std::string_view scheme;
+    std::string_view userinfo;
+    std::string_view host;
+    int port = -1;
+    std::string_view path;
+    std::string_view query;
+    std::string_view fragment;
+};
+
+/**
+ * @brief Split an absolute URL in one pass, without allocating
+ * @return std::nullopt for a malformed URL, including a bad percent-encoding
+ *         or a space or control character anywhere in it
+ */
+std::optional<UrlView> parse_url_view(std::string_view url);
+
+/**
+ * @brief Decode %XX escapes; malformed ones are kept as they are
+ */
+std::string percent_decode(std::string_view text);
+
+/**
+ * @brief Escape everything but unreserved characters (RFC 3986 section 2.3)
+ */
+std::string percent_encode(std::string_view text);
+
+/**
+ * @brief Append encoded query parameters to a URL or path in one buffer
+ *
+ * Names and values are percent-encoded as they are appended, with no
+ * intermediate strings. The first parameter starts the query with '?', or
+ * continues one the base already has with '&'. Without a base, only the
+ * query is built. The base must not have a fragment.
+ *
+ *     QueryBuilder url("https://api.example.com/search");
+ *     url.add("q", "rock & roll").add("limit", 50);
+ *     client.get(url.str());
+ */
+class QueryBuilder {
+public:
+    QueryBuilder() = default;
+    explicit QueryBuilder(std::string_view base);
+
+    QueryBuilder& add(std::string_view name, std::string_view value);
+    QueryBuilder& add(std::string_view name, int64_t value);
+
+    const std::string& str() const { return buffer_; }
+
+    /**
+     * @brief Drop the parameters, keeping the base and the capacity
+     */
+    void clear();
+
+private:
+    std::string buffer_;
+    size_t base_size_ = 0;
+    char first_separator_ = '\0';   // none for an empty base or one ending in '?' or '&'
+    char separator_ = '\0';
+
+    void begin_parameter(std::string_view name);
+};
+
+/**
+ * @brief An application/x-www-form-urlencoded body built in one buffer
+ *
+ * Encoded as HTML forms do: spaces become '+'.
+ */
+class FormBody {
+public:
+    static constexpr const char* CONTENT_TYPE = "application/x-www-form-urlencoded";
+
+    FormBody& add(std::string_view name, std::string_view value);
+    FormBody& add(std::string_view name, int64_t value);
+
+    const std::string& str() const { return buffer_; }
+
+    /**
+     * @brief Drop the fields, keeping the capacity
+     */
+    void clear() { buffer_.clear(); }
+
+private:
+    std::string buffer_;
+
+    void begin_field(std::string_view name);
+};
+
+/**
+ * @brief Resolve hosts ahead of their first request, in parallel
+ *
+ * Blocks until every lookup finished and leaves the answers in the cache
+ * shared by all clients.
+ * @return Number of hosts that resolved
+ */
+size_t prewarm_dns(const std::vector<std::string>& hosts, const ClientConfig& config = ClientConfig{});
+
+/**
+ * @brief Drop every cached DNS answer, positive and negative
+ */
+void clear_dns_cache();
+
 } // namespace conduit
 
+// Implementation of CONDUIT_JSON_FIELDS: one json_field() per member
+#define CONDUIT_JSON_EXPAND_(x) x
+#define CONDUIT_JSON_FIELD_(T, f) ::conduit::detail::json_field(#f, &T::f)
+#define CONDUIT_JSON_FE_1(T, f) CONDUIT_JSON_FIELD_(T, f)
+#define CONDUIT_JSON_FE_2(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_1(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_3(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_2(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_4(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_3(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_5(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_4(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_6(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_5(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_7(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_6(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_8(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_7(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_9(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_8(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_10(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_9(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_11(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_10(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_12(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_11(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_13(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_12(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_14(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_13(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_15(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_14(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_16(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_15(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_17(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_16(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_18(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_17(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_19(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_18(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_20(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_19(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_21(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_20(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_22(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_21(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_23(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_22(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_24(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_23(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_25(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_24(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_26(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_25(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_27(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_26(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_28(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_27(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_29(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_28(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_30(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_29(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_31(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_30(T, __VA_ARGS__))
+#define CONDUIT_JSON_FE_32(T, f, ...) CONDUIT_JSON_FIELD_(T, f), CONDUIT_JSON_EXPAND_(CONDUIT_JSON_FE_31(T, __VA_ARGS__))
+#define CONDUIT_JSON_SELECT_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, NAME, ...) NAME
+
+/**
+ * @brief Bind a struct's public members to JSON keys of the same names
+ *
+ * Use at namespace scope, in the struct's own namespace, for up to 32
+ * members. The struct must be default-constructible.
+ *
+ * @code
+ * struct User { int64_t id; std::string name; std::optional<std::string> email; };
+ * CONDUIT_JSON_FIELDS(User, id, name, email);
+ *
+ * User user = response.as<User>();
+ * conn.post_json("/users", user);
+ * @endcode
+ */
+#define CONDUIT_JSON_FIELDS(Type, ...) \
+    inline constexpr auto conduit_json_fields(const Type*) { \
+        return std::make_tuple(CONDUIT_JSON_EXPAND_(CONDUIT_JSON_SELECT_(__VA_ARGS__, \
+            CONDUIT_JSON_FE_32, CONDUIT_JSON_FE_31, CONDUIT_JSON_FE_30, CONDUIT_JSON_FE_29, \
+            CONDUIT_JSON_FE_28, CONDUIT_JSON_FE_27, CONDUIT_JSON_FE_26, CONDUIT_JSON_FE_25, \
+            CONDUIT_JSON_FE_24, CONDUIT_JSON_FE_23, CONDUIT_JSON_FE_22, CONDUIT_JSON_FE_21, \
+            CONDUIT_JSON_FE_20, CONDUIT_JSON_FE_19, CONDUIT_JSON_FE_18, CONDUIT_JSON_FE_17, \
+            CONDUIT_JSON_FE_16, CONDUIT_JSON_FE_15, CONDUIT_JSON_FE_14, CONDUIT_JSON_FE_13, \
+            CONDUIT_JSON_FE_12, CONDUIT_JSON_FE_11, CONDUIT_JSON_FE_10, CONDUIT_JSON_FE_9, \
+            CONDUIT_JSON_FE_8, CONDUIT_JSON_FE_7, CONDUIT_JSON_FE_6, CONDUIT_JSON_FE_5, \
+            CONDUIT_JSON_FE_4, CONDUIT_JSON_FE_3, CONDUIT_JSON_FE_2, CONDUIT_JSON_FE_1)(Type, __VA_ARGS__))); \
+    } \
+    static_assert(true, "")
+
 #endif // CONDUIT_HPP
@@ -0,0 +1,180 @@
+#ifndef CONDUIT_ASYNC_HPP
+#define CONDUIT_ASYNC_HPP
+
+/**
+ * @file conduit_async.hpp
+ * @brief Single-threaded asynchronous HTTP client
+ *
+ * An EventLoop multiplexes many in-flight requests over non-blocking
+ * sockets from one thread. AsyncClient issues requests on a loop and reports
+ * each result through a callback or a std::future.
+ */
+
+#include "conduit.hpp"
+#include <exception>
+#include <functional>
+#include <future>
+
+namespace conduit {
+
+/**
+ * @brief Drives non-blocking I/O and posted tasks on a single thread
+ *
+ * The loop is not thread-safe except for post() and stop(); everything
+ * else, including AsyncClient callbacks, runs on the thread calling run().
+ */
+class EventLoop {
+public:
+    /**
+     * @brief Create a loop using config.io_backend
+     */
+    explicit EventLoop(const ClientConfig& config = ClientConfig{});
+    ~EventLoop();
+
+    // Non-copyable and non-movable: clients keep a reference to the loop
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    /**
+     * @brief Process events until no request or task is outstanding, or
+     *        until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Wait up to timeout for events and dispatch them once
+     * @return true while requests or tasks are still outstanding
+     */
+    bool run_once(std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
+    /**
+     * @brief Make a running run() return; safe from any thread
+     */
+    void stop();
+
+    /**
+     * @brief Queue a task to run on the loop thread; safe from any thread
+     */
+    void post(std::function<void()> task);
+
+    using TimerId = uint64_t;
+
+    /**
+     * @brief Run task on the loop thread once delay has elapsed
+     *
+     * Call from the loop thread. A pending timer keeps run() going.
+     */
+    TimerId call_after(std::chrono::milliseconds delay, std::function<void()> task);
+
+    /**
+     * @brief Cancel a pending timer; call from the loop thread
+     * @return true if the timer had not fired yet
+     */
+    bool cancel_timer(TimerId id);
+
+    /**
+     * @brief Whether the calling thread is currently running this loop
+     */
+    bool in_loop_thread() const;
+
+    /**
+     * @brief Name of the I/O backend in use
+     */
+    const char* backend_name() const;
+
+    class Impl;
+
+private:
+    friend class AsyncClient;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief Completion callback for asynchronous requests
+ *
+ * Exactly one of error and response is set. Callbacks run on the loop
+ * thread and may issue further requests.
+ */
+using ResponseCallback = std::function<void(std::exception_ptr error, std::optional<Response> response)>;
+
+/**
+ * @brief Asynchronous HTTP client bound to an EventLoop
+ *
+ * Requests may be issued from any thread; work started off the loop thread
+ * is handed over through EventLoop::post(). Keep-alive connections are
+ * reused across requests to the same host and port, subject to the same
+ * ClientConfig pool limits as HttpClient.
+ *
+ * Destroy the client on the loop thread (or while the loop is not
+ * running); requests still in flight are dropped without their callbacks.
+ */
+class AsyncClient {
+public:
+    explicit AsyncClient(EventLoop& loop, const ClientConfig& config = ClientConfig{});
+    ~AsyncClient();
+
+    // Non-copyable and non-movable: in-flight requests point back at it
+    AsyncClient(const AsyncClient&) = delete;
+    AsyncClient& operator=(const AsyncClient&) = delete;
+
+    /**
+     * @brief Identifies an in-flight request for cancel()
+     */
+    using RequestId = uint64_t;
+
+    /**
+     * @brief Start a request; the callback runs exactly once
+     *
+     * A request not answered within ClientConfig::timeout fails with
+     * TimeoutException.
+     */
+    RequestId get(const std::string& url, ResponseCallback callback,
+                  const HeaderMap& headers = {});
+    RequestId post(const std::string& url, const std::string& body, const std::string& content_type,
+                   ResponseCallback callback, const HeaderMap& headers = {});
+    RequestId post_json(const std::string& url, const JsonValue& json, ResponseCallback callback,
+                        const HeaderMap& headers = {});
+
+    /**
+     * @brief Fail a request with CancelledException and close its socket
+     *
+     * Safe from any thread. Does nothing if the request already completed.
+     */
+    void cancel(RequestId id);
+
+    /**
+     * @brief Future-returning variants
+     *
+     * Wait on the future from a thread other than the one running the loop.
+     */
+    std::future<Response> get_future(const std::string& url,
+                                     const HeaderMap& headers = {});
+    std::future<Response> post_future(const std::string& url, const std::string& body,
+                                      const std::string& content_type = "application/json",
+                                      const HeaderMap& headers = {});
+    std::future<Response> post_json_future(const std::string& url, const JsonValue& json,
+                                           const HeaderMap& headers = {});
+
+    /**
+     * @brief Requests submitted and not yet completed
+     */
+    size_t in_flight() const;
+
+    /**
+     * @brief Idle keep-alive connections; call on the loop thread
+     */
+    size_t idle_connections() const;
+
+    class Impl;
+
+private:
+    std::unique_ptr<Impl> impl_;
+
+    RequestId submit(const std::string& method, const std::string& url, const std::string& body,
+                     std::string_view content_type, const HeaderMap& headers, ResponseCallback callback);
+};
+
+} // namespace conduit
+
+#endif // CONDUIT_ASYNC_HPP
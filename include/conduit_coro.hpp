@@ -0,0 +1,415 @@
+#ifndef CONDUIT_CORO_HPP
+#define CONDUIT_CORO_HPP
+
+/**
+ * @file conduit_coro.hpp
+ * @brief C++20 coroutine interface over AsyncClient
+ *
+ * Header-only: the library itself stays C++17, and only translation units
+ * that include this header need to be compiled as C++20.
+ *
+ * @code
+ * conduit::Task<int> fetch(conduit::AsyncClient& client) {
+ *     auto response = co_await conduit::async_get(client, "http://example.com/");
+ *     co_return response.status_code();
+ * }
+ *
+ * int status = conduit::sync_wait(loop, fetch(client));
+ * @endcode
+ */
+
+#include "conduit_async.hpp"
+
+#if !defined(__cpp_impl_coroutine)
+#error "conduit_coro.hpp requires C++20 coroutine support"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace conduit {
+
+template<typename T = void>
+class Task;
+
+namespace detail {
+    struct TaskPromiseBase {
+        std::coroutine_handle<> continuation = std::noop_coroutine();
+        std::exception_ptr error;
+
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> finished) noexcept {
+                // Symmetric transfer: chains of awaits do not grow the stack
+                return finished.promise().continuation;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+    };
+
+    template<typename T>
+    struct TaskPromise : TaskPromiseBase {
+        std::optional<T> value;
+
+        Task<T> get_return_object() noexcept;
+
+        template<typename U>
+        void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+
+        T take() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return std::move(*value);
+        }
+    };
+
+    template<>
+    struct TaskPromise<void> : TaskPromiseBase {
+        Task<void> get_return_object() noexcept;
+
+        void return_void() const noexcept {}
+
+        void take() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    };
+
+    /**
+     * @brief Eagerly started, self-destroying coroutine used to drive a Task
+     */
+    struct Detached {
+        struct promise_type {
+            Detached get_return_object() const noexcept { return {}; }
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend() const noexcept { return {}; }
+            void return_void() const noexcept {}
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+    };
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine producing a T
+ *
+ * The body runs when the Task is first awaited and resumes the awaiting
+ * coroutine when it finishes; exceptions propagate to the awaiter.
+ * Move-only. Destroying a Task that has not started frees its frame.
+ */
+template<typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+
+    T await_resume() { return handle_.promise().take(); }
+
+private:
+    friend promise_type;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+    template<typename T>
+    Task<T> TaskPromise<T>::get_return_object() noexcept {
+        return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+        return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+    }
+
+    template<typename Start>
+    class RequestAwaiter;
+} // namespace detail
+
+/**
+ * @brief Cooperative cancellation for awaited requests
+ *
+ * Copies share state. cancel() fails the request currently awaited with the
+ * token (CancelledException) and every later one before it is sent. Safe
+ * to call from any thread.
+ */
+class CancellationToken {
+public:
+    CancellationToken() : state_(std::make_shared<State>()) {}
+
+    void cancel() const {
+        std::function<void()> action;
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (state_->cancelled) return;
+            state_->cancelled = true;
+            action = std::move(state_->action);
+        }
+        if (action) {
+            action();
+        }
+    }
+
+    bool cancelled() const {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        return state_->cancelled;
+    }
+
+private:
+    template<typename Start>
+    friend class detail::RequestAwaiter;
+
+    struct State {
+        std::mutex mutex;
+        bool cancelled = false;
+        std::function<void()> action;
+    };
+
+    std::shared_ptr<State> state_;
+
+    void set_action(std::function<void()> action) const {
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (!state_->cancelled) {
+                state_->action = std::move(action);
+                return;
+            }
+        }
+        action();
+    }
+
+    void clear_action() const {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->action = nullptr;
+    }
+};
+
+namespace detail {
+    /**
+     * @brief Suspends a coroutine until an AsyncClient request completes
+     *
+     * Start is called with the completion callback and returns the request id.
+     */
+    template<typename Start>
+    class RequestAwaiter {
+    public:
+        RequestAwaiter(AsyncClient& client, Start start, CancellationToken token)
+            : client_(client), start_(std::move(start)), token_(std::move(token)) {}
+
+        bool await_ready() {
+            if (token_.cancelled()) {
+                error_ = std::make_exception_ptr(CancelledException("Cancelled before it was sent"));
+                return true;
+            }
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> awaiting) {
+            awaiting_ = awaiting;
+            AsyncClient::RequestId id = start_([this](std::exception_ptr error, std::optional<Response> response) {
+                error_ = error;
+                response_ = std::move(response);
+                if (completed_.exchange(true)) {
+                    awaiting_.resume();
+                }
+            });
+
+            AsyncClient& client = client_;
+            token_.set_action([&client, id] { client.cancel(id); });
+
+            // A request started off the loop thread may already have finished;
+            // whoever gets here second resumes the coroutine
+            return !completed_.exchange(true);
+        }
+
+        Response await_resume() {
+            token_.clear_action();
+            if (error_) {
+                std::rethrow_exception(error_);
+            }
+            return std::move(*response_);
+        }
+
+    private:
+        AsyncClient& client_;
+        Start start_;
+        CancellationToken token_;
+        std::coroutine_handle<> awaiting_;
+        std::atomic<bool> completed_{false};
+        std::exception_ptr error_;
+        std::optional<Response> response_;
+    };
+} // namespace detail
+
+/**
+ * @brief Awaitable request functions
+ *
+ * Each returns a lazily started Task: the request is issued when the Task
+ * is first awaited, on the awaiting thread, and the coroutine resumes on
+ * the loop thread. Failures, including TimeoutException after
+ * ClientConfig::timeout and CancelledException, are thrown from co_await.
+ */
+inline Task<Response> async_get(AsyncClient& client, std::string url,
+                                HeaderMap headers = {},
+                                CancellationToken token = {}) {
+    co_return co_await detail::RequestAwaiter(client, [&](ResponseCallback callback) {
+        return client.get(url, std::move(callback), headers);
+    }, std::move(token));
+}
+
+inline Task<Response> async_post(AsyncClient& client, std::string url, std::string body,
+                                 std::string content_type = "application/json",
+                                 HeaderMap headers = {},
+                                 CancellationToken token = {}) {
+    co_return co_await detail::RequestAwaiter(client, [&](ResponseCallback callback) {
+        return client.post(url, body, content_type, std::move(callback), headers);
+    }, std::move(token));
+}
+
+inline Task<Response> async_post_json(AsyncClient& client, std::string url, JsonValue json,
+                                      HeaderMap headers = {},
+                                      CancellationToken token = {}) {
+    co_return co_await detail::RequestAwaiter(client, [&](ResponseCallback callback) {
+        return client.post_json(url, json, std::move(callback), headers);
+    }, std::move(token));
+}
+
+/**
+ * @brief Resume the awaiting coroutine on the loop thread
+ *
+ * Hops a coroutine started elsewhere onto the loop via EventLoop::post().
+ */
+inline auto schedule(EventLoop& loop) {
+    struct Awaiter {
+        EventLoop& loop;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> awaiting) const {
+            loop.post([awaiting] { awaiting.resume(); });
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{loop};
+}
+
+/**
+ * @brief Suspend for at least delay; await on the loop thread
+ */
+inline auto sleep_for(EventLoop& loop, std::chrono::milliseconds delay) {
+    struct Awaiter {
+        EventLoop& loop;
+        std::chrono::milliseconds delay;
+
+        bool await_ready() const noexcept { return delay.count() <= 0; }
+        void await_suspend(std::coroutine_handle<> awaiting) const {
+            loop.call_after(delay, [awaiting] { awaiting.resume(); });
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{loop, delay};
+}
+
+/**
+ * @brief Run a Task to completion on the loop without waiting for it
+ *
+ * The Task starts from a posted task on the loop thread. An exception
+ * escaping it is rethrown from the thread running the loop.
+ */
+inline void spawn(EventLoop& loop, Task<void> task) {
+    auto drive = [](EventLoop& loop, Task<void> task) -> detail::Detached {
+        try {
+            co_await task;
+        } catch (...) {
+            loop.post([error = std::current_exception()] { std::rethrow_exception(error); });
+        }
+    };
+
+    auto shared = std::make_shared<Task<void>>(std::move(task));
+    loop.post([&loop, drive, shared] { drive(loop, std::move(*shared)); });
+}
+
+/**
+ * @brief Run the loop on the calling thread until task completes
+ *
+ * Other work on the loop makes progress meanwhile. Must not be called
+ * from inside the loop. Throws std::logic_error if the Task suspends with
+ * nothing left on the loop that could resume it.
+ */
+template<typename T>
+T sync_wait(EventLoop& loop, Task<T> task) {
+    struct Outcome {
+        bool done = false;
+        std::exception_ptr error;
+        std::optional<std::conditional_t<std::is_void_v<T>, bool, T>> value;
+    } outcome;
+
+    auto drive = [](Task<T> task, Outcome& outcome) -> detail::Detached {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                co_await task;
+                outcome.value.emplace(true);
+            } else {
+                outcome.value.emplace(co_await task);
+            }
+        } catch (...) {
+            outcome.error = std::current_exception();
+        }
+        outcome.done = true;
+    };
+
+    auto shared = std::make_shared<Task<T>>(std::move(task));
+    loop.post([drive, shared, &outcome] { drive(std::move(*shared), outcome); });
+
+    while (!outcome.done) {
+        if (!loop.run_once() && !outcome.done) {
+            throw std::logic_error("Task suspended with nothing on the loop to resume it");
+        }
+    }
+
+    if (outcome.error) {
+        std::rethrow_exception(outcome.error);
+    }
+    if constexpr (!std::is_void_v<T>) {
+        return std::move(*outcome.value);
+    }
+}
+
+} // namespace conduit
+
+#endif // CONDUIT_CORO_HPP
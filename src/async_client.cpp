@@ -0,0 +1,725 @@
+#include "conduit_async.hpp"
+#include "event_loop.hpp"
+#include "http_parser.hpp"
+#include "http_request.hpp"
+#include "resolver.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/socket.h>
+
+namespace conduit {
+
+namespace {
+    constexpr size_t MAX_BODY_RESERVE = 16 * 1024 * 1024;
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief A serialized request and the callback waiting for it
+     */
+    struct PendingRequest {
+        AsyncClient::RequestId id = 0;
+        std::string host;
+        int port = 80;
+        std::shared_ptr<const std::string> wire;     // shared with the backend while it sends
+        bool head = false;
+        bool idempotent = true;
+        bool retried = false;
+        ResponseCallback callback;
+    };
+
+    std::string make_key(const std::string& host, int port) {
+        return host + ":" + std::to_string(port);
+    }
+
+    ResponseCallback make_future_callback(std::shared_ptr<std::promise<Response>> promise) {
+        return [promise](std::exception_ptr error, std::optional<Response> response) {
+            if (error) {
+                promise->set_exception(error);
+            } else {
+                promise->set_value(std::move(*response));
+            }
+        };
+    }
+
+    class AsyncConnection;
+} // anonymous namespace
+
+/**
+ * @brief Connection bookkeeping for AsyncClient
+ *
+ * Owns every live AsyncConnection and the per host:port lists of idle
+ * keep-alive ones. Runs entirely on the loop thread; work arriving from
+ * other threads (submissions, cancellations, DNS answers) goes through
+ * post(), which drops it once the client is gone.
+ */
+class AsyncClient::Impl {
+public:
+    Impl(EventLoop::Impl& loop, const ClientConfig& config)
+        : loop_(loop), config_(config), default_headers_(config.default_headers),
+          guard_(std::make_shared<Guard>()) {
+        guard_->impl = this;
+    }
+    ~Impl();
+
+    EventLoop::Impl& loop() { return loop_; }
+    const ClientConfig& config() const { return config_; }
+    const HeaderMap& default_headers() const { return default_headers_; }
+    size_t idle_count() const { return idle_count_; }
+
+    void submit(std::unique_ptr<PendingRequest> request);
+    void start_fresh(std::unique_ptr<PendingRequest> request);
+
+    void release(AsyncConnection* conn);
+    void discard_idle(AsyncConnection* conn);
+    void destroy(AsyncConnection* conn);
+
+    void finish(std::unique_ptr<PendingRequest> request, std::exception_ptr error,
+                std::optional<Response> response);
+    void finish_later(std::unique_ptr<PendingRequest> request, std::exception_ptr error);
+
+    void abort(RequestId id, std::exception_ptr error);
+
+    /**
+     * @brief Look host up off the loop thread and continue the request
+     */
+    void resolve_async(RequestId id, const std::string& host, int port);
+
+    /**
+     * @brief Run task on the loop thread if the client still exists then
+     */
+    void post(std::function<void(Impl&)> task);
+
+    std::atomic<size_t> in_flight{0};
+    std::atomic<RequestId> next_id{1};
+
+private:
+    /**
+     * @brief Lets resolver threads and queued tasks see whether the client is gone
+     *
+     * The mutex only covers reading and clearing impl; no task runs under it.
+     */
+    struct Guard {
+        std::mutex mutex;
+        Impl* impl = nullptr;
+    };
+
+    EventLoop::Impl& loop_;
+    ClientConfig config_;
+    HeaderMap default_headers_;     // config_.default_headers, rendered once
+    std::shared_ptr<Guard> guard_;
+    std::unordered_map<RequestId, EventLoop::TimerId> deadlines_;
+    std::unordered_map<AsyncConnection*, std::unique_ptr<AsyncConnection>> connections_;
+    std::unordered_map<std::string, std::vector<AsyncConnection*>> idle_;
+    std::unordered_map<RequestId, AsyncConnection*> active_;
+    size_t idle_count_ = 0;
+
+    void evict_oldest_idle();
+};
+
+namespace {
+    /**
+     * @brief One keep-alive socket driven by the event loop
+     *
+     * Carries one request at a time. The receive side stays armed while the
+     * connection is idle so a server-side close is noticed immediately.
+     * complete(), fail() and the idle close path may destroy the object and
+     * must be the last thing a callback does.
+     */
+    class AsyncConnection : public IoHandler {
+    public:
+        AsyncConnection(AsyncClient::Impl& client, std::string key)
+            : client_(client), key_(std::move(key)) {}
+
+        ~AsyncConnection() override {
+            if (channel_open_) {
+                client_.loop().backend().close(channel_);
+            }
+            stop_racing();
+        }
+
+        const std::string& key() const { return key_; }
+        Clock::time_point idle_since;
+
+        /**
+         * @brief Fail the current request and close the socket
+         */
+        void abort(std::exception_ptr error) { fail(error, false); }
+
+        void open(std::unique_ptr<PendingRequest> request) {
+            request_ = std::move(request);
+            reused_ = false;
+
+            EndpointList endpoints;
+            bool known;
+            try {
+                known = Resolver::shared().try_resolve(request_->host, request_->port, client_.config(), endpoints);
+            } catch (const ConnectionException&) {
+                fail_later(std::current_exception());
+                return;
+            }
+
+            if (known) {
+                connect_to(std::move(endpoints));
+            } else {
+                client_.resolve_async(request_->id, request_->host, request_->port);
+            }
+        }
+
+        /**
+         * @brief Continue open() once an asynchronous lookup finished
+         */
+        void resolved(EndpointList endpoints, std::exception_ptr error) {
+            if (error) {
+                fail(error, false);
+                return;
+            }
+            connect_to(std::move(endpoints));
+        }
+
+        void reuse(std::unique_ptr<PendingRequest> request) {
+            request_ = std::move(request);
+            reused_ = true;
+            send_request();
+        }
+
+        void on_connect(ChannelId channel, int error) override {
+            IoBackend& backend = client_.loop().backend();
+            auto attempt = std::find_if(attempts_.begin(), attempts_.end(),
+                                        [channel](const Attempt& a) { return a.channel == channel; });
+            int family = attempt->family;
+            attempts_.erase(attempt);
+
+            if (error != 0) {
+                backend.close(channel);
+                // A failed attempt hands its turn to the next address right away
+                cancel_timer(stagger_timer_);
+                if (start_attempt() || !attempts_.empty()) {
+                    return;
+                }
+                fail(std::make_exception_ptr(ConnectionException(
+                    "Connection failed to " + request_->host + ":" + std::to_string(request_->port))), false);
+                return;
+            }
+
+            stop_racing();
+            channel_ = channel;
+            channel_open_ = true;
+            Resolver::shared().remember_family(request_->host, family);
+            backend.start_recv(channel_);
+            send_request();
+        }
+
+        void on_send(ssize_t result) override {
+            sending_ = false;
+            if (result >= 0 || !request_) {
+                return;
+            }
+            if (result == -EPIPE || result == -ECONNRESET) {
+                fail(std::make_exception_ptr(ConnectionException("Connection reset by peer")), true);
+            } else {
+                fail(std::make_exception_ptr(RequestException("Failed to send data")), false);
+            }
+        }
+
+        void on_recv(const char* data, ssize_t result) override {
+            if (!request_) {
+                // EOF, an error or unsolicited bytes on an idle socket
+                client_.discard_idle(this);
+                return;
+            }
+
+            if (result < 0) {
+                fail(std::make_exception_ptr(ResponseException("Failed to receive response data")),
+                     !got_bytes_ && request_->idempotent);
+                return;
+            }
+            if (result == 0) {
+                if (parser_.finish()) {
+                    complete(false);
+                } else if (!got_bytes_) {
+                    fail(std::make_exception_ptr(
+                        ConnectionException("Server closed connection without a response")),
+                        request_->idempotent);
+                } else {
+                    fail(std::make_exception_ptr(
+                        ResponseException("Connection closed before response was complete")), false);
+                }
+                return;
+            }
+
+            got_bytes_ = true;
+            const char* input = data;
+            size_t length = static_cast<size_t>(result);
+            if (!carry_.empty()) {
+                carry_.append(data, length);
+                input = carry_.data();
+                length = carry_.size();
+            }
+
+            size_t offset = 0;
+            try {
+                while (offset < length && !parser_.complete()) {
+                    std::string_view chunk;
+                    size_t used = parser_.feed(input + offset, length - offset, chunk);
+                    offset += used;
+                    if (!chunk.empty()) {
+                        if (body_.empty() && parser_.content_length() > 0) {
+                            body_.reserve(std::min(static_cast<size_t>(parser_.content_length()), MAX_BODY_RESERVE));
+                        }
+                        body_.append(chunk.data(), chunk.size());
+                    }
+                    if (used == 0) {
+                        break;
+                    }
+                }
+            } catch (...) {
+                fail(std::current_exception(), false);
+                return;
+            }
+
+            if (parser_.complete()) {
+                complete(offset < length);
+                return;
+            }
+
+            // Keep the partial line for the next read
+            if (input == data) {
+                carry_.assign(input + offset, length - offset);
+            } else {
+                carry_.erase(0, offset);
+            }
+        }
+
+    private:
+        AsyncClient::Impl& client_;
+        std::string key_;
+        ChannelId channel_ = 0;
+        bool channel_open_ = false;
+        // Happy Eyeballs state while connecting
+        struct Attempt {
+            ChannelId channel;
+            int family;
+        };
+        EndpointList endpoints_;
+        size_t next_endpoint_ = 0;
+        std::vector<Attempt> attempts_;
+        EventLoop::TimerId stagger_timer_ = 0;
+        EventLoop::TimerId connect_timer_ = 0;
+
+        std::unique_ptr<PendingRequest> request_;
+        bool reused_ = false;
+        bool sending_ = false;
+        bool got_bytes_ = false;
+        ResponseParser parser_;
+        std::string carry_;
+        std::string body_;
+
+        /**
+         * @brief Race the endpoints as in RFC 8305, bounded by connect_timeout
+         */
+        void connect_to(const EndpointList& endpoints) {
+            endpoints_ = Resolver::shared().connect_order(request_->host, endpoints);
+            next_endpoint_ = 0;
+            if (!start_attempt()) {
+                fail_later(std::make_exception_ptr(ConnectionException("Socket creation failed")));
+                return;
+            }
+
+            connect_timer_ = client_.loop().add_timer(client_.config().connect_timeout, [this] {
+                connect_timer_ = 0;
+                fail(std::make_exception_ptr(TimeoutException(
+                    "Connecting to " + request_->host + ":" + std::to_string(request_->port) + " timed out")), false);
+            });
+        }
+
+        /**
+         * @brief Start connecting to the next endpoint
+         *
+         * If more endpoints remain, the one after it starts once this attempt
+         * has had connection_attempt_delay to itself.
+         */
+        bool start_attempt() {
+            IoBackend& backend = client_.loop().backend();
+            while (next_endpoint_ < endpoints_.size()) {
+                const Endpoint& endpoint = endpoints_[next_endpoint_++];
+                int fd = ::socket(endpoint.addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+                if (fd < 0) {
+                    continue;
+                }
+                ChannelId channel;
+                try {
+                    channel = backend.attach(fd, this);
+                } catch (const ConnectionException&) {
+                    ::close(fd);
+                    continue;
+                }
+                attempts_.push_back(Attempt{channel, endpoint.addr.ss_family});
+                backend.connect(channel, reinterpret_cast<const sockaddr*>(&endpoint.addr), endpoint.length);
+
+                if (next_endpoint_ < endpoints_.size()) {
+                    stagger_timer_ = client_.loop().add_timer(client_.config().connection_attempt_delay, [this] {
+                        stagger_timer_ = 0;
+                        start_attempt();
+                    });
+                }
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Close the attempts still racing and drop the connect timers
+         */
+        void stop_racing() {
+            IoBackend& backend = client_.loop().backend();
+            for (const auto& attempt : attempts_) {
+                backend.close(attempt.channel);
+            }
+            attempts_.clear();
+            cancel_timer(stagger_timer_);
+            cancel_timer(connect_timer_);
+        }
+
+        void cancel_timer(EventLoop::TimerId& timer) {
+            if (timer != 0) {
+                client_.loop().cancel_timer(timer);
+                timer = 0;
+            }
+        }
+
+        void send_request() {
+            got_bytes_ = false;
+            sending_ = true;
+            parser_.reset(request_->head);
+            client_.loop().backend().send(channel_, request_->wire);
+        }
+
+        /**
+         * @param trailing Bytes followed the response, so the stream is out of sync
+         */
+        void complete(bool trailing) {
+            auto request = std::move(request_);
+            Response response(parser_.status_code(), std::move(body_), std::move(parser_.headers()));
+            // An unfinished send still references the request buffer
+            bool reusable = parser_.keep_alive() && !trailing && !sending_;
+
+            body_ = std::string();
+            carry_.clear();
+            parser_.reset();
+
+            AsyncClient::Impl& client = client_;
+            if (reusable) {
+                client.release(this);
+            } else {
+                client.destroy(this);
+            }
+            client.finish(std::move(request), nullptr, std::move(response));
+        }
+
+        /**
+         * @param retryable Sending again cannot repeat an action: the write
+         *                  failed, or the server may have read the request
+         *                  but its method is idempotent (RFC 9112 section
+         *                  9.3.1). Only a reused socket is ever retried.
+         */
+        void fail(std::exception_ptr error, bool retryable) {
+            auto request = std::move(request_);
+            bool retry = retryable && reused_ && !request->retried;
+
+            AsyncClient::Impl& client = client_;
+            client.destroy(this);
+            if (retry) {
+                request->retried = true;
+                client.start_fresh(std::move(request));
+                return;
+            }
+            client.finish(std::move(request), error, std::nullopt);
+        }
+
+        void fail_later(std::exception_ptr error) {
+            auto request = std::move(request_);
+            AsyncClient::Impl& client = client_;
+            client.destroy(this);
+            client.finish_later(std::move(request), error);
+        }
+    };
+} // anonymous namespace
+
+AsyncClient::Impl::~Impl() {
+    {
+        // Tasks still queued on the loop, or coming from the resolver, are dropped
+        std::lock_guard<std::mutex> lock(guard_->mutex);
+        guard_->impl = nullptr;
+    }
+    for (auto& [id, timer] : deadlines_) {
+        loop_.cancel_timer(timer);
+    }
+    for (size_t remaining = in_flight.exchange(0); remaining > 0; --remaining) {
+        loop_.remove_work();
+    }
+    connections_.clear();
+}
+
+void AsyncClient::Impl::post(std::function<void(Impl&)> task) {
+    std::shared_ptr<Guard> guard = guard_;
+    loop_.post([guard, task = std::move(task)] {
+        Impl* impl;
+        {
+            std::lock_guard<std::mutex> lock(guard->mutex);
+            impl = guard->impl;
+        }
+        // Run unlocked: the task may reach a user callback, which may destroy
+        // the client. Destruction happens on this thread, so impl stays valid
+        // until then.
+        if (impl) {
+            task(*impl);
+        }
+    });
+}
+
+void AsyncClient::Impl::resolve_async(RequestId id, const std::string& host, int port) {
+    std::shared_ptr<Guard> guard = guard_;
+    Resolver::shared().resolve_async(host, port, config_, [guard, id](EndpointList endpoints,
+                                                                     std::exception_ptr error) {
+        // Runs on a resolver thread: hand the answer to the loop
+        std::lock_guard<std::mutex> lock(guard->mutex);
+        if (!guard->impl) return;
+        auto shared = std::make_shared<EndpointList>(std::move(endpoints));
+        guard->impl->post([id, shared, error](Impl& impl) {
+            auto it = impl.active_.find(id);
+            if (it != impl.active_.end()) {
+                it->second->resolved(std::move(*shared), error);
+            }
+        });
+    });
+}
+
+void AsyncClient::Impl::submit(std::unique_ptr<PendingRequest> request) {
+    RequestId id = request->id;
+    deadlines_[id] = loop_.add_timer(config_.timeout, [this, id] {
+        abort(id, std::make_exception_ptr(TimeoutException("No response within the configured timeout")));
+    });
+
+    auto it = idle_.find(make_key(request->host, request->port));
+    auto now = Clock::now();
+
+    while (it != idle_.end() && !it->second.empty()) {
+        // Most recently used first: the least likely to have been closed
+        AsyncConnection* conn = it->second.back();
+        it->second.pop_back();
+        --idle_count_;
+
+        if (now - conn->idle_since >= config_.idle_timeout) {
+            destroy(conn);
+            continue;
+        }
+        active_[id] = conn;
+        conn->reuse(std::move(request));
+        return;
+    }
+
+    start_fresh(std::move(request));
+}
+
+void AsyncClient::Impl::start_fresh(std::unique_ptr<PendingRequest> request) {
+    auto owned = std::make_unique<AsyncConnection>(*this, make_key(request->host, request->port));
+    AsyncConnection* conn = owned.get();
+    connections_.emplace(conn, std::move(owned));
+    active_[request->id] = conn;
+    conn->open(std::move(request));
+}
+
+void AsyncClient::Impl::release(AsyncConnection* conn) {
+    if (config_.max_idle_connections == 0 || config_.max_idle_per_host == 0) {
+        destroy(conn);
+        return;
+    }
+
+    auto& host_idle = idle_[conn->key()];
+    if (host_idle.size() >= config_.max_idle_per_host) {
+        AsyncConnection* oldest = host_idle.front();
+        host_idle.erase(host_idle.begin());
+        --idle_count_;
+        destroy(oldest);
+    }
+    while (idle_count_ >= config_.max_idle_connections) {
+        evict_oldest_idle();
+    }
+
+    conn->idle_since = Clock::now();
+    host_idle.push_back(conn);
+    ++idle_count_;
+}
+
+void AsyncClient::Impl::discard_idle(AsyncConnection* conn) {
+    auto it = idle_.find(conn->key());
+    if (it != idle_.end()) {
+        auto& host_idle = it->second;
+        auto pos = std::find(host_idle.begin(), host_idle.end(), conn);
+        if (pos != host_idle.end()) {
+            host_idle.erase(pos);
+            --idle_count_;
+        }
+    }
+    destroy(conn);
+}
+
+void AsyncClient::Impl::destroy(AsyncConnection* conn) {
+    connections_.erase(conn);
+}
+
+void AsyncClient::Impl::evict_oldest_idle() {
+    std::vector<AsyncConnection*>* oldest = nullptr;
+    for (auto& [key, host_idle] : idle_) {
+        if (!host_idle.empty() && (!oldest || host_idle.front()->idle_since < oldest->front()->idle_since)) {
+            oldest = &host_idle;
+        }
+    }
+    if (!oldest) return;
+
+    AsyncConnection* conn = oldest->front();
+    oldest->erase(oldest->begin());
+    --idle_count_;
+    destroy(conn);
+}
+
+void AsyncClient::Impl::finish(std::unique_ptr<PendingRequest> request, std::exception_ptr error,
+                               std::optional<Response> response) {
+    active_.erase(request->id);
+    auto deadline = deadlines_.find(request->id);
+    if (deadline != deadlines_.end()) {
+        loop_.cancel_timer(deadline->second);
+        deadlines_.erase(deadline);
+    }
+    --in_flight;
+    loop_.remove_work();
+    if (request->callback) {
+        request->callback(error, std::move(response));
+    }
+}
+
+void AsyncClient::Impl::finish_later(std::unique_ptr<PendingRequest> request, std::exception_ptr error) {
+    // Never invoke a callback from inside the call that issued the request
+    active_.erase(request->id);
+    std::shared_ptr<PendingRequest> shared(std::move(request));
+    post([shared, error](Impl& impl) {
+        impl.finish(std::make_unique<PendingRequest>(std::move(*shared)), error, std::nullopt);
+    });
+}
+
+void AsyncClient::Impl::abort(RequestId id, std::exception_ptr error) {
+    // Unknown ids belong to requests that already completed
+    auto it = active_.find(id);
+    if (it != active_.end()) {
+        it->second->abort(error);
+    }
+}
+
+// AsyncClient implementation
+AsyncClient::AsyncClient(EventLoop& loop, const ClientConfig& config)
+    : impl_(std::make_unique<Impl>(*loop.impl_, config)) {}
+
+AsyncClient::~AsyncClient() = default;
+
+AsyncClient::RequestId AsyncClient::submit(const std::string& method, const std::string& url,
+                                           const std::string& body, std::string_view content_type,
+                                           const HeaderMap& headers, ResponseCallback callback) {
+    ParsedUrl parsed = parse_url(url);
+
+    auto request = std::make_unique<PendingRequest>();
+    request->id = impl_->next_id++;
+    request->host = parsed.host;
+    request->port = parsed.port;
+    request->head = method == "HEAD";
+    request->idempotent = is_idempotent(method);
+    // The wire bytes must outlive the caller's buffers, so this is the one copy
+    request->wire = std::make_shared<const std::string>(build_http_request(
+        method, parsed.target(), parsed.host, impl_->default_headers(), headers, content_type, body));
+    request->callback = std::move(callback);
+
+    RequestId id = request->id;
+    ++impl_->in_flight;
+    EventLoop::Impl& loop = impl_->loop();
+    loop.add_work();
+
+    if (loop.in_loop_thread()) {
+        impl_->submit(std::move(request));
+        return id;
+    }
+
+    std::shared_ptr<PendingRequest> shared(std::move(request));
+    impl_->post([shared](Impl& impl) {
+        impl.submit(std::make_unique<PendingRequest>(std::move(*shared)));
+    });
+    return id;
+}
+
+AsyncClient::RequestId AsyncClient::get(const std::string& url, ResponseCallback callback,
+                                        const HeaderMap& headers) {
+    return submit("GET", url, "", {}, headers, std::move(callback));
+}
+
+AsyncClient::RequestId AsyncClient::post(const std::string& url, const std::string& body,
+                                         const std::string& content_type, ResponseCallback callback,
+                                         const HeaderMap& headers) {
+    return submit("POST", url, body, content_type, headers, std::move(callback));
+}
+
+AsyncClient::RequestId AsyncClient::post_json(const std::string& url, const JsonValue& json,
+                                              ResponseCallback callback,
+                                              const HeaderMap& headers) {
+    return post(url, serialize_json(json), "application/json", std::move(callback), headers);
+}
+
+void AsyncClient::cancel(RequestId id) {
+    auto error = std::make_exception_ptr(CancelledException("Cancelled by caller"));
+    EventLoop::Impl& loop = impl_->loop();
+    if (loop.in_loop_thread()) {
+        impl_->abort(id, error);
+        return;
+    }
+
+    // Posted after any submit() from this thread, so the request is known
+    impl_->post([id, error](Impl& impl) { impl.abort(id, error); });
+}
+
+std::future<Response> AsyncClient::get_future(const std::string& url,
+                                              const HeaderMap& headers) {
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto future = promise->get_future();
+    get(url, make_future_callback(promise), headers);
+    return future;
+}
+
+std::future<Response> AsyncClient::post_future(const std::string& url, const std::string& body,
+                                               const std::string& content_type,
+                                               const HeaderMap& headers) {
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto future = promise->get_future();
+    post(url, body, content_type, make_future_callback(promise), headers);
+    return future;
+}
+
+std::future<Response> AsyncClient::post_json_future(const std::string& url, const JsonValue& json,
+                                                    const HeaderMap& headers) {
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto future = promise->get_future();
+    post_json(url, json, make_future_callback(promise), headers);
+    return future;
+}
+
+size_t AsyncClient::in_flight() const {
+    return impl_->in_flight.load();
+}
+
+size_t AsyncClient::idle_connections() const {
+    return impl_->idle_count();
+}
+
+} // namespace conduit
@@ -1,12 +1,13 @@
 #include "conduit.hpp"
+#include "connection_pool.hpp"
+#include "http_parser.hpp"
+#include "http_request.hpp"
+#include "resolver.hpp"
 #include <iostream>
-#include <sstream>
-#include <regex>
 #include <stdexcept>
 #include <algorithm>
 #include <cctype>
 #include <cstring>
-#include <array>
 
 // System includes for socket operations
 #include <unistd.h>
@@ -16,11 +17,18 @@
 #include <netdb.h>
 #include <sys/time.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <charconv>
+#include <climits>
+#include <sys/uio.h>
 
 namespace conduit {
 
 namespace {
-    constexpr size_t BUFFER_SIZE = 4096;
+    constexpr size_t BUFFER_SIZE = 16 * 1024;
+    constexpr size_t MAX_BODY_RESERVE = 16 * 1024 * 1024;
+    constexpr size_t MAX_RETAINED_TX_BODY = 1024 * 1024;  // kept between post_json calls
     constexpr int DEFAULT_TIMEOUT_SEC = 30;
     
     /**
@@ -72,6 +80,18 @@ namespace {
         int fd_;
     };
     
+    /**
+     * @brief Check that an idle keep-alive socket is still usable
+     *
+     * A pooled socket must have nothing to read: EOF means the server closed
+     * it, and unsolicited bytes mean the stream is out of sync.
+     */
+    bool socket_is_idle(int sockfd) {
+        char probe;
+        ssize_t n = recv(sockfd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+        return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+    }
+    
     /**
      * @brief Set socket timeout
      */
@@ -91,196 +111,162 @@ namespace {
     
     /**
      * @brief Create and connect socket
+     *
+     * Races the resolved addresses Happy Eyeballs style (RFC 8305): each
+     * attempt gets connection_attempt_delay to succeed before the next one
+     * starts alongside it, a failed attempt starts the next immediately, and
+     * the first connection to complete wins. The whole race is bounded by
+     * connect_timeout. Returns a blocking socket.
      */
-    Socket connect_socket(const std::string& hostname, int port) {
-        struct hostent* server = gethostbyname(hostname.c_str());
-        if (!server) {
-            throw ConnectionException("Hostname resolution failed for: " + hostname);
-        }
-        
-        Socket sock(socket(AF_INET, SOCK_STREAM, 0));
-        if (!sock.is_valid()) {
-            throw ConnectionException("Socket creation failed");
-        }
-        
-        struct sockaddr_in server_addr;
-        server_addr.sin_family = AF_INET;
-        server_addr.sin_port = htons(port);
-        memcpy(&server_addr.sin_addr.s_addr, server->h_addr_list[0], server->h_length);
-        
-        if (connect(sock.fd(), reinterpret_cast<struct sockaddr*>(&server_addr), sizeof(server_addr)) < 0) {
-            throw ConnectionException("Connection failed to " + hostname + ":" + std::to_string(port));
-        }
-        
-        return sock;
-    }
-    
-    /**
-     * @brief Send data through socket
-     */
-    void send_data(int sockfd, const std::string& data) {
-        size_t total_sent = 0;
-        while (total_sent < data.length()) {
-            ssize_t sent = send(sockfd, data.c_str() + total_sent, data.length() - total_sent, 0);
-            if (sent <= 0) {
-                throw RequestException("Failed to send data");
-            }
-            total_sent += sent;
-        }
-    }
-    
-    /**
-     * @brief Receive HTTP response
-     */
-    std::string receive_response(int sockfd) {
-        std::string response;
-        std::array<char, BUFFER_SIZE> buffer;
-        
-        int content_length = -1;
-        bool headers_complete = false;
-        size_t header_end_pos = 0;
-        
+    Socket connect_socket(const std::string& hostname, int port, const ClientConfig& config) {
+        using Clock = std::chrono::steady_clock;
+
+        Resolver& resolver = Resolver::shared();
+        EndpointList endpoints = resolver.connect_order(hostname, resolver.resolve(hostname, port, config));
+
+        struct Attempt {
+            Socket sock;
+            int family;
+        };
+        std::vector<Attempt> attempts;
+        std::vector<pollfd> fds;
+        size_t next = 0;
+        bool created = false;
+
+        auto now = Clock::now();
+        auto deadline = now + config.connect_timeout;
+        auto next_start = now;
+
+        auto won = [&](Attempt& attempt) {
+            int flags = fcntl(attempt.sock.fd(), F_GETFL);
+            fcntl(attempt.sock.fd(), F_SETFL, flags & ~O_NONBLOCK);
+            resolver.remember_family(hostname, attempt.family);
+            return std::move(attempt.sock);
+        };
+
         while (true) {
-            ssize_t bytes_received = recv(sockfd, buffer.data(), buffer.size(), 0);
-            
-            if (bytes_received > 0) {
-                response.append(buffer.data(), bytes_received);
-                
-                // Check for end of headers
-                if (!headers_complete) {
-                    size_t header_end = response.find("\r\n\r\n");
-                    if (header_end != std::string::npos) {
-                        headers_complete = true;
-                        header_end_pos = header_end + 4;
-                        
-                        // Parse Content-Length
-                        size_t cl_pos = response.find("Content-Length: ");
-                        if (cl_pos != std::string::npos && cl_pos < header_end) {
-                            size_t cl_start = cl_pos + 16;
-                            size_t cl_end = response.find("\r\n", cl_start);
-                            if (cl_end != std::string::npos) {
-                                content_length = std::stoi(response.substr(cl_start, cl_end - cl_start));
-                            }
-                        }
-                    }
+            now = Clock::now();
+            if (next < endpoints.size() && (attempts.empty() || now >= next_start)) {
+                const Endpoint& endpoint = endpoints[next++];
+                Attempt attempt{Socket(socket(endpoint.addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)),
+                                endpoint.addr.ss_family};
+                if (!attempt.sock.is_valid()) {
+                    continue;
+                }
+                created = true;
+
+                if (connect(attempt.sock.fd(), reinterpret_cast<const struct sockaddr*>(&endpoint.addr),
+                            endpoint.length) == 0) {
+                    return won(attempt);
                 }
-                
-                // Check if we have complete response
-                if (headers_complete && content_length >= 0) {
-                    size_t body_length = response.length() - header_end_pos;
-                    if (body_length >= static_cast<size_t>(content_length)) {
-                        break;
-                    }
+                if (errno == EINPROGRESS) {
+                    attempts.push_back(std::move(attempt));
+                    next_start = now + config.connection_attempt_delay;
                 }
-            } else if (bytes_received == 0) {
-                // Connection closed
-                break;
-            } else {
-                throw ResponseException("Failed to receive response data");
+                continue;
+            }
+
+            if (attempts.empty()) {
+                if (!created) {
+                    throw ConnectionException("Socket creation failed");
+                }
+                throw ConnectionException("Connection failed to " + hostname + ":" + std::to_string(port));
+            }
+            if (now >= deadline) {
+                throw TimeoutException("Connecting to " + hostname + ":" + std::to_string(port) + " timed out");
+            }
+
+            auto until = next < endpoints.size() ? std::min(deadline, next_start) : deadline;
+            auto wait = std::chrono::ceil<std::chrono::milliseconds>(until - now);
+
+            fds.clear();
+            for (const auto& attempt : attempts) {
+                fds.push_back(pollfd{attempt.sock.fd(), POLLOUT, 0});
+            }
+            if (poll(fds.data(), fds.size(), static_cast<int>(wait.count())) < 0 && errno != EINTR) {
+                throw ConnectionException("Failed to wait for connection");
+            }
+
+            for (size_t i = fds.size(); i-- > 0;) {
+                if (fds[i].revents == 0) {
+                    continue;
+                }
+                int error = 0;
+                socklen_t length = sizeof(error);
+                getsockopt(fds[i].fd, SOL_SOCKET, SO_ERROR, &error, &length);
+                if (error == 0) {
+                    return won(attempts[i]);
+                }
+                // A failed attempt hands its turn to the next address right away
+                attempts.erase(attempts.begin() + static_cast<std::ptrdiff_t>(i));
+                next_start = Clock::now();
             }
         }
-        
-        return response;
     }
     
     /**
-     * @brief Parse HTTP response
+     * @brief Send several buffers with as few syscalls as the kernel allows
      */
-    Response parse_http_response(const std::string& response_data) {
-        // Find the end of headers
-        size_t header_end = response_data.find("\r\n\r\n");
-        if (header_end == std::string::npos) {
-            throw ResponseException("Invalid HTTP response format");
-        }
-        
-        std::string headers_section = response_data.substr(0, header_end);
-        std::string body = response_data.substr(header_end + 4);
-        
-        // Parse status line
-        size_t first_line_end = headers_section.find("\r\n");
-        if (first_line_end == std::string::npos) {
-            throw ResponseException("Invalid HTTP status line");
-        }
-        
-        std::string status_line = headers_section.substr(0, first_line_end);
-        
-        // Extract status code
-        size_t first_space = status_line.find(' ');
-        size_t second_space = status_line.find(' ', first_space + 1);
-        if (first_space == std::string::npos || second_space == std::string::npos) {
-            throw ResponseException("Invalid HTTP status line format");
-        }
-        
-        int status_code = std::stoi(status_line.substr(first_space + 1, second_space - first_space - 1));
-        
-        // Parse headers
-        std::map<std::string, std::string> headers;
-        std::istringstream header_stream(headers_section.substr(first_line_end + 2));
-        std::string header_line;
-        
-        while (std::getline(header_stream, header_line)) {
-            if (header_line.back() == '\r') {
-                header_line.pop_back();
+    void send_vectored(int sockfd, iovec* buffers, size_t count) {
+        size_t index = 0;
+        while (index < count) {
+            msghdr message{};
+            message.msg_iov = buffers + index;
+            message.msg_iovlen = count - index;
+
+            ssize_t sent = sendmsg(sockfd, &message, MSG_NOSIGNAL);
+            if (sent <= 0) {
+                if (sent < 0 && (errno == EPIPE || errno == ECONNRESET)) {
+                    throw ConnectionException("Connection reset by peer");
+                }
+                throw RequestException("Failed to send data");
             }
-            
-            size_t colon_pos = header_line.find(':');
-            if (colon_pos != std::string::npos) {
-                std::string name = header_line.substr(0, colon_pos);
-                std::string value = header_line.substr(colon_pos + 1);
-                
-                // Trim whitespace
-                value.erase(0, value.find_first_not_of(" \t"));
-                value.erase(value.find_last_not_of(" \t") + 1);
-                
-                headers[name] = value;
+
+            // Skip what went out; a partially sent buffer is trimmed in place
+            size_t remaining = static_cast<size_t>(sent);
+            while (index < count && remaining >= buffers[index].iov_len) {
+                remaining -= buffers[index].iov_len;
+                ++index;
+            }
+            if (remaining > 0) {
+                buffers[index].iov_base = static_cast<char*>(buffers[index].iov_base) + remaining;
+                buffers[index].iov_len -= remaining;
             }
         }
-        
-        return Response(status_code, std::move(body), std::move(headers));
     }
-    
+
     /**
-     * @brief Build HTTP request
+     * @brief Whether a slot value can go into the request line unchanged
      */
-    std::string build_http_request(const std::string& method, const std::string& path,
-                                  const std::string& hostname, const std::string& body,
-                                  const std::map<std::string, std::string>& headers) {
-        std::ostringstream request;
-        request << method << " " << path << " HTTP/1.1\r\n";
-        request << "Host: " << hostname << "\r\n";
-        
-        // Add custom headers
-        for (const auto& [name, value] : headers) {
-            request << name << ": " << value << "\r\n";
-        }
-        
-        // Add Content-Length for POST requests
-        if (!body.empty()) {
-            request << "Content-Length: " << body.length() << "\r\n";
-        }
-        
-        request << "\r\n";
-        
-        if (!body.empty()) {
-            request << body;
+    bool is_valid_slot_value(std::string_view value) {
+        for (char c : value) {
+            if (static_cast<unsigned char>(c) <= ' ' || c == 0x7f) {
+                return false;
+            }
         }
-        
-        return request.str();
+        return true;
     }
 } // anonymous namespace
 
 // JsonValue implementations
 std::optional<int> JsonValue::get_int(const std::string& key) const {
+    auto value = get_int64(key);
+    return value ? std::optional<int>(static_cast<int>(*value)) : std::nullopt;
+}
+
+std::optional<int64_t> JsonValue::get_int64(const std::string& key) const {
     if (!is_object()) return std::nullopt;
-    
+
     auto obj = as_object();
     if (!obj) return std::nullopt;
-    
+
     auto it = obj->find(key);
     if (it == obj->end()) return std::nullopt;
-    
-    if (it->second->is_number()) {
-        return static_cast<int>(it->second->as_number());
+
+    // Doubles past the int64_t range have no integer value
+    const JsonValue& value = *it->second;
+    if (value.is_integer() || (value.is_number() && detail::fits_int64(value.as_number()))) {
+        return value.as_int64();
     }
     return std::nullopt;
 }
@@ -332,7 +318,8 @@ std::optional<double> JsonValue::get_number(const std::string& key) const {
 
 // Connection implementation
 HttpClient::Connection::Connection(const std::string& hostname, int port, const ClientConfig& config)
-    : hostname_(hostname), port_(port), config_(config), socket_fd_(-1), connected_(false) {
+    : hostname_(hostname), port_(port), config_(config), socket_fd_(-1), connected_(false),
+      default_headers_(config.default_headers) {
     connect();
 }
 
@@ -340,31 +327,46 @@ HttpClient::Connection::~Connection() {
     disconnect();
 }
 
+HttpClient::Connection::Connection(Connection&& other) noexcept
+    : hostname_(std::move(other.hostname_)), port_(other.port_), config_(std::move(other.config_)),
+      socket_fd_(other.socket_fd_), connected_(other.connected_), keep_alive_(other.keep_alive_),
+      last_used_(other.last_used_), rx_buffer_(std::move(other.rx_buffer_)),
+      rx_begin_(other.rx_begin_), rx_end_(other.rx_end_), tx_body_(std::move(other.tx_body_)),
+      tx_head_(std::move(other.tx_head_)), default_headers_(std::move(other.default_headers_)) {
+    other.socket_fd_ = -1;
+    other.connected_ = false;
+    other.rx_begin_ = other.rx_end_ = 0;
+}
+
+HttpClient::Connection& HttpClient::Connection::operator=(Connection&& other) noexcept {
+    if (this != &other) {
+        disconnect();
+        hostname_ = std::move(other.hostname_);
+        port_ = other.port_;
+        config_ = std::move(other.config_);
+        socket_fd_ = other.socket_fd_;
+        connected_ = other.connected_;
+        keep_alive_ = other.keep_alive_;
+        last_used_ = other.last_used_;
+        rx_buffer_ = std::move(other.rx_buffer_);
+        rx_begin_ = other.rx_begin_;
+        rx_end_ = other.rx_end_;
+        tx_body_ = std::move(other.tx_body_);
+        tx_head_ = std::move(other.tx_head_);
+        default_headers_ = std::move(other.default_headers_);
+        other.socket_fd_ = -1;
+        other.connected_ = false;
+        other.rx_begin_ = other.rx_end_ = 0;
+    }
+    return *this;
+}
+
 void HttpClient::Connection::connect() {
     if (connected_) return;
     
-    struct hostent* server = gethostbyname(hostname_.c_str());
-    if (!server) {
-        throw ConnectionException("Hostname resolution failed for: " + hostname_);
-    }
-    
-    socket_fd_ = socket(AF_INET, SOCK_STREAM, 0);
-    if (socket_fd_ < 0) {
-        throw ConnectionException("Socket creation failed");
-    }
-    
-    struct sockaddr_in server_addr;
-    server_addr.sin_family = AF_INET;
-    server_addr.sin_port = htons(port_);
-    memcpy(&server_addr.sin_addr.s_addr, server->h_addr_list[0], server->h_length);
-    
-    if (::connect(socket_fd_, reinterpret_cast<struct sockaddr*>(&server_addr), sizeof(server_addr)) < 0) {
-        close(socket_fd_);
-        socket_fd_ = -1;
-        throw ConnectionException("Connection failed to " + hostname_ + ":" + std::to_string(port_));
-    }
-    
-    set_socket_timeout(socket_fd_, config_.timeout);
+    Socket sock = connect_socket(hostname_, port_, config_);
+    set_socket_timeout(sock.fd(), config_.timeout);
+    socket_fd_ = sock.release();
     connected_ = true;
 }
 
@@ -374,91 +376,500 @@ void HttpClient::Connection::disconnect() {
         socket_fd_ = -1;
     }
     connected_ = false;
+    rx_begin_ = rx_end_ = 0;
 }
 
-Response HttpClient::Connection::get(const std::string& path, const std::map<std::string, std::string>& headers) {
+bool HttpClient::Connection::is_reusable() const {
+    return connected_ && keep_alive_ && rx_begin_ == rx_end_ && socket_is_idle(socket_fd_);
+}
+
+size_t HttpClient::Connection::fill_receive_buffer() {
+    // Keep any unconsumed bytes (a partial header line) at the front
+    if (rx_begin_ == rx_end_) {
+        rx_begin_ = rx_end_ = 0;
+    } else if (rx_begin_ > 0) {
+        std::memmove(rx_buffer_.data(), rx_buffer_.data() + rx_begin_, rx_end_ - rx_begin_);
+        rx_end_ -= rx_begin_;
+        rx_begin_ = 0;
+    }
+    
+    if (rx_end_ == rx_buffer_.size()) {
+        rx_buffer_.resize(std::max(BUFFER_SIZE, rx_buffer_.size() * 2));
+    }
+    
+    ssize_t bytes_received = recv(socket_fd_, rx_buffer_.data() + rx_end_, rx_buffer_.size() - rx_end_, 0);
+    if (bytes_received < 0) {
+        if (errno == ECONNRESET) {
+            throw ConnectionException("Connection reset by peer");
+        }
+        throw ResponseException("Failed to receive response data");
+    }
+    rx_end_ += static_cast<size_t>(bytes_received);
+    return static_cast<size_t>(bytes_received);
+}
+
+Response HttpClient::Connection::receive_response(bool head_request, const StreamHandler* stream) {
+    ResponseParser parser;
+    parser.reset(head_request);
+    std::string body;
+    bool headers_delivered = false;
+    
+    while (true) {
+        if (rx_begin_ < rx_end_) {
+            std::string_view chunk;
+            size_t consumed = parser.feed(rx_buffer_.data() + rx_begin_, rx_end_ - rx_begin_, chunk);
+            rx_begin_ += consumed;
+            
+            if (!headers_delivered && parser.headers_complete()) {
+                headers_delivered = true;
+                if (!stream && parser.content_length() > 0) {
+                    body.reserve(std::min(static_cast<size_t>(parser.content_length()), MAX_BODY_RESERVE));
+                } else if (stream && stream->on_headers) {
+                    stream->on_headers(parser.status_code(), parser.headers());
+                }
+            }
+            if (!chunk.empty()) {
+                if (!stream) {
+                    body.append(chunk.data(), chunk.size());
+                } else if (stream->on_data) {
+                    stream->on_data(chunk.data(), chunk.size());
+                }
+            }
+            if (parser.complete()) {
+                break;
+            }
+            if (consumed > 0) {
+                continue;
+            }
+        }
+        
+        size_t received;
+        try {
+            received = fill_receive_buffer();
+        } catch (const ConnectionException&) {
+            // Before the response began this looks like a dropped idle
+            // socket; callers decide by method whether a resend is safe
+            if (parser.started()) {
+                throw ResponseException("Connection reset before response was complete");
+            }
+            throw;
+        }
+        if (received == 0) {
+            if (parser.finish()) {
+                break;
+            }
+            if (!parser.started()) {
+                throw ConnectionException("Server closed connection without a response");
+            }
+            throw ResponseException("Connection closed before response was complete");
+        }
+    }
+    
+    keep_alive_ = parser.keep_alive();
+    return Response(parser.status_code(), std::move(body), std::move(parser.headers()));
+}
+
+Response HttpClient::Connection::get(const std::string& path, const HeaderMap& headers) {
     return send_request("GET", path, "", headers);
 }
 
 Response HttpClient::Connection::post(const std::string& path, const std::string& body,
                                     const std::string& content_type,
-                                    const std::map<std::string, std::string>& headers) {
-    auto merged_headers = headers;
-    merged_headers["Content-Type"] = content_type;
-    return send_request("POST", path, body, merged_headers);
+                                    const HeaderMap& headers) {
+    return send_request("POST", path, body, headers, nullptr, content_type);
 }
 
 Response HttpClient::Connection::post_json(const std::string& path, const JsonValue& json,
-                                         const std::map<std::string, std::string>& headers) {
-    std::string json_body = serialize_json(json);
-    return post(path, json_body, "application/json", headers);
+                                         const HeaderMap& headers) {
+    // Serialized into a buffer that keeps its capacity across requests,
+    // then sent from there without another copy
+    tx_body_.clear();
+    JsonWriter(tx_body_).value(json);
+    return post_tx_body(path, headers);
+}
+
+Response HttpClient::Connection::post_form(const std::string& path, const FormBody& form,
+                                         const HeaderMap& headers) {
+    return post(path, form.str(), FormBody::CONTENT_TYPE, headers);
+}
+
+Response HttpClient::Connection::post_tx_body(const std::string& path,
+                                             const HeaderMap& headers) {
+    Response response = post(path, tx_body_, "application/json", headers);
+    if (tx_body_.capacity() > MAX_RETAINED_TX_BODY) {
+        std::string().swap(tx_body_);
+    }
+    return response;
+}
+
+Response HttpClient::Connection::get_stream(const std::string& path, const StreamHandler& handler,
+                                           const HeaderMap& headers) {
+    return send_request("GET", path, "", headers, &handler);
+}
+
+Response HttpClient::Connection::get_stream(const std::string& path, std::ostream& out,
+                                           const HeaderMap& headers) {
+    StreamHandler handler;
+    handler.on_data = [&out](const char* data, size_t size) {
+        if (!out.write(data, static_cast<std::streamsize>(size))) {
+            throw ResponseException("Failed to write response body to stream");
+        }
+    };
+    return get_stream(path, handler, headers);
+}
+
+Response HttpClient::Connection::get_stream(const std::string& path, JsonHandler& handler,
+                                           const HeaderMap& headers) {
+    JsonStreamParser parser(handler);
+    bool is_json = false;
+    StreamHandler stream;
+    stream.on_headers = [&is_json](int, const HeaderMap& response_headers) {
+        auto content_type = response_headers.get(header::content_type);
+        is_json = content_type && content_type->find("json") != std::string_view::npos;
+    };
+    stream.on_data = [&](const char* data, size_t size) {
+        if (is_json && !parser.feed(data, size)) {
+            throw ResponseException("Malformed JSON in response body at byte " + std::to_string(parser.offset()));
+        }
+    };
+
+    Response response = get_stream(path, stream, headers);
+    if (is_json && parser.offset() > 0 && !parser.finish()) {
+        throw ResponseException("Truncated JSON in response body");
+    }
+    return response;
+}
+
+Response HttpClient::Connection::get_json_lines(const std::string& path,
+                                               const JsonLinesParser::RecordHandler& on_record,
+                                               const HeaderMap& headers,
+                                               size_t max_line_bytes) {
+    struct Stopped {};
+
+    JsonLinesParser parser([&on_record](const JsonNode& record) { return on_record(record); }, max_line_bytes);
+    bool is_json = false;
+    int status_code = 0;
+    HeaderMap response_headers;
+    StreamHandler stream;
+    stream.on_headers = [&](int status, const HeaderMap& received) {
+        status_code = status;
+        response_headers = received;
+        auto content_type = received.get(header::content_type);
+        is_json = content_type && content_type->find("json") != std::string_view::npos;
+    };
+    stream.on_data = [&](const char* data, size_t size) {
+        if (!is_json || parser.feed(data, size)) {
+            return;
+        }
+        if (parser.stopped()) {
+            throw Stopped{};
+        }
+        throw ResponseException("Malformed or overlong JSON on line " + std::to_string(parser.line()) +
+                                " of response body");
+    };
+
+    try {
+        Response response = get_stream(path, stream, headers);
+        if (is_json && !parser.finish()) {
+            throw ResponseException("Malformed JSON on line " + std::to_string(parser.line()) + " of response body");
+        }
+        return response;
+    } catch (const Stopped&) {
+        // The rest of the body may never end, so the connection cannot be reused
+        disconnect();
+        return Response(status_code, "", std::move(response_headers));
+    }
+}
+
+Response HttpClient::Connection::stream_request(const std::string& method, const std::string& path,
+                                               const std::string& body, const StreamHandler& handler,
+                                               const HeaderMap& headers) {
+    return send_request(method, path, body, headers, &handler);
 }
 
 Response HttpClient::Connection::send_request(const std::string& method, const std::string& path,
-                                             const std::string& body, const std::map<std::string, std::string>& headers) {
+                                             const std::string& body, const HeaderMap& headers,
+                                             const StreamHandler* stream, std::string_view content_type) {
     if (!connected_) {
         throw ConnectionException("Not connected to server");
     }
     
-    // Merge default headers with request headers
-    auto merged_headers = config_.default_headers;
-    merged_headers.insert(headers.begin(), headers.end());
+    // Only the request's own lines are formatted; the default headers and
+    // the body go out from where they already are
+    RequestParts parts;
+    build_http_request(method, path, hostname_, default_headers_, headers, content_type, body, parts);
+    std::vector<iovec> buffers;
+    buffers.reserve(4);
+    parts.gather(buffers);
+    keep_alive_ = false;
+    send_vectored(socket_fd_, buffers.data(), buffers.size());
     
-    std::string request = build_http_request(method, path, hostname_, body, merged_headers);
-    send_data(socket_fd_, request);
-    
-    std::string response_data = receive_response(socket_fd_);
-    return parse_http_response(response_data);
+    return receive_response(method == "HEAD", stream);
+}
+
+std::vector<Response> HttpClient::Connection::pipeline(const std::vector<PipelinedRequest>& requests) {
+    std::vector<Response> responses;
+    responses.reserve(requests.size());
+
+    std::vector<RequestParts> wire;
+    std::vector<iovec> buffers;
+    size_t depth = std::max<size_t>(1, std::min<size_t>(config_.pipeline_depth, IOV_MAX / 4));
+    bool sequential = false;
+
+    // A socket opened here that fails before answering anything is a real
+    // error; on any other socket the server may just have closed it
+    bool fresh_socket = false;
+    size_t answered_on_socket = 0;
+
+    size_t next = 0;
+    while (next < requests.size()) {
+        if (!connected_) {
+            connect();
+            fresh_socket = true;
+            answered_on_socket = 0;
+        }
+
+        size_t end = next;
+        while (end < requests.size() && end - next < (sequential ? 1 : depth)) {
+            if (!is_idempotent(requests[end++].method)) {
+                break;
+            }
+        }
+
+        // Up to four buffers per request, none of them a copy of a body
+        wire.resize(std::max(wire.size(), end - next));
+        buffers.clear();
+        for (size_t i = next; i < end; ++i) {
+            const PipelinedRequest& request = requests[i];
+            build_http_request(request.method, request.path, hostname_, default_headers_, request.headers, {},
+                               request.body, wire[i - next]);
+            wire[i - next].gather(buffers);
+        }
+
+        std::exception_ptr failure;
+        try {
+            keep_alive_ = false;
+            send_vectored(socket_fd_, buffers.data(), buffers.size());
+            while (next < end) {
+                responses.push_back(receive_response(requests[next].method == "HEAD", nullptr));
+                ++next;
+                ++answered_on_socket;
+                if (!keep_alive_) {
+                    break;
+                }
+            }
+        } catch (const ConnectionException&) {
+            if (fresh_socket && answered_on_socket == 0) {
+                throw;
+            }
+            failure = std::current_exception();
+            keep_alive_ = false;
+        }
+
+        // The server closed: resend whatever it did not answer, one at a
+        // time. After an announced close the server ignores the rest, but a
+        // dropped connection may have carried a request it acted on, so an
+        // unanswered one that is not idempotent fails (RFC 9112 section 9.3.1)
+        if (!keep_alive_) {
+            disconnect();
+            if (failure && std::any_of(requests.begin() + next, requests.begin() + end,
+                                       [](const PipelinedRequest& r) { return !is_idempotent(r.method); })) {
+                std::rethrow_exception(failure);
+            }
+            sequential = true;
+        }
+    }
+
+    return responses;
+}
+
+void RequestTemplate::render_head(std::initializer_list<std::string_view> slots, size_t body_size,
+                                  std::string& out) const {
+    if (slots.size() != slots_.size()) {
+        throw RequestException("Request template expects " + std::to_string(slots_.size()) +
+                               " slot values, got " + std::to_string(slots.size()));
+    }
+
+    out.clear();
+    out.append(segments_[0]);
+    const std::string_view* value = slots.begin();
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (!is_valid_slot_value(value[i])) {
+            throw RequestException("Invalid value for slot {" + slots_[i] + "}");
+        }
+        out.append(value[i]).append(segments_[i + 1]);
+    }
+    out.append(tail_);
+    if (body_size > 0) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), body_size);
+        out.append("Content-Length: ").append(digits, result.ptr).append("\r\n");
+    }
+    out.append("\r\n");
+}
+
+RequestTemplate HttpClient::Connection::prepare(const std::string& method, const std::string& path_pattern,
+                                               const HeaderMap& headers) const {
+    RequestTemplate request;
+    request.method_ = method;
+    request.hostname_ = hostname_;
+
+    std::string segment = method + " ";
+    size_t i = 0;
+    while (i < path_pattern.size()) {
+        size_t open = path_pattern.find('{', i);
+        if (open == std::string::npos) {
+            segment.append(path_pattern, i, std::string::npos);
+            break;
+        }
+        size_t close = path_pattern.find('}', open + 1);
+        if (close == std::string::npos || close == open + 1) {
+            throw RequestException("Malformed slot in path pattern: " + path_pattern);
+        }
+        segment.append(path_pattern, i, open - i);
+        request.segments_.push_back(std::move(segment));
+        segment.clear();
+        request.slots_.push_back(path_pattern.substr(open + 1, close - open - 1));
+        i = close + 1;
+    }
+    request.segments_.push_back(std::move(segment));
+    request.tail_ = render_request_tail(hostname_, default_headers_, headers);
+    return request;
+}
+
+Response HttpClient::Connection::send(const RequestTemplate& request, std::initializer_list<std::string_view> slots,
+                                      std::string_view body) {
+    if (!connected_) {
+        throw ConnectionException("Not connected to server");
+    }
+    if (request.hostname_ != hostname_) {
+        throw RequestException("Request template was prepared for " + request.hostname_);
+    }
+
+    // Only the slot values and Content-Length are formatted, into a buffer
+    // that keeps its capacity across calls
+    request.render_head(slots, body.size(), tx_head_);
+
+    iovec buffers[2] = {{tx_head_.data(), tx_head_.size()},
+                        {const_cast<char*>(body.data()), body.size()}};
+    keep_alive_ = false;
+    send_vectored(socket_fd_, buffers, body.empty() ? 1 : 2);
+
+    return receive_response(request.method_ == "HEAD", nullptr);
 }
 
 // HttpClient implementation
-HttpClient::HttpClient(const ClientConfig& config) : config_(config) {}
+HttpClient::HttpClient(const ClientConfig& config)
+    : config_(config), pool_(std::make_unique<ConnectionPool>(config)) {}
 
 HttpClient::~HttpClient() = default;
+HttpClient::HttpClient(HttpClient&&) noexcept = default;
+HttpClient& HttpClient::operator=(HttpClient&&) noexcept = default;
 
 HttpClient::Connection HttpClient::connect(const std::string& hostname, int port) {
     return Connection(hostname, port, config_);
 }
 
-Response HttpClient::get(const std::string& url, const std::map<std::string, std::string>& headers) {
+template <typename RequestFn>
+Response HttpClient::send_pooled(const std::string& method, const std::string& host, int port,
+                                 RequestFn&& request) {
+    bool reused = false;
+    Connection conn = pool_->acquire(host, port, reused);
+    
+    try {
+        Response response = request(conn);
+        pool_->release(std::move(conn));
+        return response;
+    } catch (const ConnectionException&) {
+        // A pooled socket can be closed by the server between our liveness
+        // check and the write; retry once on a fresh connection. The server
+        // may also have acted on the request before closing, so only methods
+        // that may be repeated are retried (RFC 9112 section 9.3.1).
+        if (!reused || !is_idempotent(method)) {
+            throw;
+        }
+    }
+    
+    Connection fresh(host, port, config_);
+    Response response = request(fresh);
+    pool_->release(std::move(fresh));
+    return response;
+}
+
+Response HttpClient::get(const std::string& url, const HeaderMap& headers) {
     ParsedUrl parsed = parse_url(url);
-    Connection conn = connect(parsed.host, parsed.port);
-    return conn.get(parsed.path + (parsed.query.empty() ? "" : "?" + parsed.query), headers);
+    std::string target = parsed.target();
+    return send_pooled("GET", parsed.host, parsed.port, [&](Connection& conn) {
+        return conn.get(target, headers);
+    });
 }
 
 Response HttpClient::post(const std::string& url, const std::string& body,
                          const std::string& content_type,
-                         const std::map<std::string, std::string>& headers) {
+                         const HeaderMap& headers) {
     ParsedUrl parsed = parse_url(url);
-    Connection conn = connect(parsed.host, parsed.port);
-    return conn.post(parsed.path, body, content_type, headers);
+    std::string target = parsed.target();
+    return send_pooled("POST", parsed.host, parsed.port, [&](Connection& conn) {
+        return conn.post(target, body, content_type, headers);
+    });
 }
 
 Response HttpClient::post_json(const std::string& url, const JsonValue& json,
-                              const std::map<std::string, std::string>& headers) {
+                              const HeaderMap& headers) {
     ParsedUrl parsed = parse_url(url);
-    Connection conn = connect(parsed.host, parsed.port);
-    return conn.post_json(parsed.path, json, headers);
+    std::string target = parsed.target();
+    return send_pooled("POST", parsed.host, parsed.port, [&](Connection& conn) {
+        return conn.post_json(target, json, headers);
+    });
 }
 
-ParsedUrl parse_url(const std::string& url) {
-    ParsedUrl result;
-    
-    // Simple URL parser - more robust parsing could be added
-    std::regex url_regex(R"(^(https?):\/\/([^:\/]+)(?::(\d+))?([^?]*)(?:\?(.*))?$)");
-    std::smatch matches;
-    
-    if (std::regex_match(url, matches, url_regex)) {
-        result.scheme = matches[1];
-        result.host = matches[2];
-        result.port = matches[3].matched ? std::stoi(matches[3]) : (result.scheme == "https" ? 443 : 80);
-        result.path = matches[4].matched ? matches[4].str() : "/";
-        result.query = matches[5].matched ? matches[5].str() : "";
-    } else {
-        throw std::invalid_argument("Invalid URL format: " + url);
-    }
-    
-    return result;
+Response HttpClient::post_form(const std::string& url, const FormBody& form,
+                              const HeaderMap& headers) {
+    return post(url, form.str(), FormBody::CONTENT_TYPE, headers);
+}
+
+Response HttpClient::get_stream(const std::string& url, const StreamHandler& handler,
+                               const HeaderMap& headers) {
+    ParsedUrl parsed = parse_url(url);
+    std::string target = parsed.target();
+    return send_pooled("GET", parsed.host, parsed.port, [&](Connection& conn) {
+        return conn.get_stream(target, handler, headers);
+    });
+}
+
+Response HttpClient::get_stream(const std::string& url, std::ostream& out,
+                               const HeaderMap& headers) {
+    ParsedUrl parsed = parse_url(url);
+    std::string target = parsed.target();
+    return send_pooled("GET", parsed.host, parsed.port, [&](Connection& conn) {
+        return conn.get_stream(target, out, headers);
+    });
+}
+
+Response HttpClient::get_stream(const std::string& url, JsonHandler& handler,
+                               const HeaderMap& headers) {
+    ParsedUrl parsed = parse_url(url);
+    std::string target = parsed.target();
+    return send_pooled("GET", parsed.host, parsed.port, [&](Connection& conn) {
+        return conn.get_stream(target, handler, headers);
+    });
+}
+
+Response HttpClient::get_json_lines(const std::string& url, const JsonLinesParser::RecordHandler& on_record,
+                                   const HeaderMap& headers, size_t max_line_bytes) {
+    ParsedUrl parsed = parse_url(url);
+    std::string target = parsed.target();
+    return send_pooled("GET", parsed.host, parsed.port, [&](Connection& conn) {
+        return conn.get_json_lines(target, on_record, headers, max_line_bytes);
+    });
+}
+
+size_t HttpClient::idle_connections() const {
+    return pool_->idle_count();
+}
+
+void HttpClient::clear_idle_connections() {
+    pool_->clear();
 }
 
 } // namespace conduit
@@ -53,13 +53,9 @@ namespace {
         return result;
     }
     
-    // Helper to convert headers map to C string
-    char* headers_to_c_string(const std::map<std::string, std::string>& headers) {
-        std::string result;
-        for (const auto& [key, value] : headers) {
-            result += key + ": " + value + "\r\n";
-        }
-        return allocate_c_string(result);
+    // Helper to convert headers to a C string; the block is already in wire format
+    char* headers_to_c_string(const conduit::HeaderMap& headers) {
+        return allocate_c_string(headers.block());
     }
 }
 
@@ -0,0 +1,104 @@
+#include "connection_pool.hpp"
+#include <algorithm>
+
+namespace conduit {
+
+ConnectionPool::ConnectionPool(const ClientConfig& config) : config_(config) {}
+
+std::string ConnectionPool::make_key(const std::string& host, int port) {
+    return host + ":" + std::to_string(port);
+}
+
+HttpClient::Connection ConnectionPool::acquire(const std::string& host, int port, bool& reused) {
+    std::vector<HttpClient::Connection> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        evict_expired(Clock::now(), evicted);
+
+        auto it = idle_.find(make_key(host, port));
+        while (it != idle_.end() && !it->second.empty()) {
+            HttpClient::Connection conn = std::move(it->second.back());
+            it->second.pop_back();
+            --total_idle_;
+
+            // The server may have closed the socket while it sat idle
+            if (conn.is_reusable()) {
+                reused = true;
+                return conn;
+            }
+            evicted.push_back(std::move(conn));
+        }
+    }
+
+    reused = false;
+    return HttpClient::Connection(host, port, config_);
+}
+
+void ConnectionPool::release(HttpClient::Connection&& conn) {
+    if (!conn.is_reusable() || config_.max_idle_connections == 0 || config_.max_idle_per_host == 0) {
+        return;
+    }
+
+    std::vector<HttpClient::Connection> evicted;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto now = Clock::now();
+    conn.last_used_ = now;
+    evict_expired(now, evicted);
+
+    auto& host_idle = idle_[make_key(conn.hostname_, conn.port_)];
+    if (host_idle.size() >= config_.max_idle_per_host) {
+        evicted.push_back(std::move(host_idle.front()));
+        host_idle.pop_front();
+        --total_idle_;
+    }
+    while (total_idle_ >= config_.max_idle_connections) {
+        evict_oldest(evicted);
+    }
+
+    host_idle.push_back(std::move(conn));
+    ++total_idle_;
+}
+
+size_t ConnectionPool::idle_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_idle_;
+}
+
+void ConnectionPool::clear() {
+    decltype(idle_) drained;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        drained.swap(idle_);
+        total_idle_ = 0;
+    }
+}
+
+void ConnectionPool::evict_expired(Clock::time_point now, std::vector<HttpClient::Connection>& evicted) {
+    for (auto it = idle_.begin(); it != idle_.end();) {
+        auto& host_idle = it->second;
+        while (!host_idle.empty() && now - host_idle.front().last_used_ >= config_.idle_timeout) {
+            evicted.push_back(std::move(host_idle.front()));
+            host_idle.pop_front();
+            --total_idle_;
+        }
+        it = host_idle.empty() ? idle_.erase(it) : std::next(it);
+    }
+}
+
+void ConnectionPool::evict_oldest(std::vector<HttpClient::Connection>& evicted) {
+    auto oldest = idle_.end();
+    for (auto it = idle_.begin(); it != idle_.end(); ++it) {
+        if (it->second.empty()) continue;
+        if (oldest == idle_.end() || it->second.front().last_used_ < oldest->second.front().last_used_) {
+            oldest = it;
+        }
+    }
+    if (oldest == idle_.end()) return;
+
+    evicted.push_back(std::move(oldest->second.front()));
+    oldest->second.pop_front();
+    --total_idle_;
+}
+
+} // namespace conduit
@@ -0,0 +1,56 @@
+#ifndef CONDUIT_CONNECTION_POOL_HPP
+#define CONDUIT_CONNECTION_POOL_HPP
+
+#include "conduit.hpp"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace conduit {
+
+/**
+ * @brief Per host/port cache of idle keep-alive connections
+ *
+ * Connections are handed out most-recently-used first, since those are the
+ * least likely to have been closed by the server. Idle sockets are dropped
+ * once they exceed ClientConfig::idle_timeout, when a host already holds
+ * ClientConfig::max_idle_per_host of them, or when the pool as a whole
+ * reaches ClientConfig::max_idle_connections.
+ */
+class ConnectionPool {
+public:
+    explicit ConnectionPool(const ClientConfig& config);
+
+    /**
+     * @brief Take an idle connection for host:port or open a new one
+     * @param reused Set to true when the connection came from the pool
+     */
+    HttpClient::Connection acquire(const std::string& host, int port, bool& reused);
+
+    /**
+     * @brief Return a connection after a completed request
+     *
+     * Connections the server asked to close, or whose response framing left
+     * the stream in an unknown state, are closed instead of pooled.
+     */
+    void release(HttpClient::Connection&& conn);
+
+    size_t idle_count() const;
+    void clear();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    ClientConfig config_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::deque<HttpClient::Connection>> idle_;
+    size_t total_idle_ = 0;
+
+    static std::string make_key(const std::string& host, int port);
+    void evict_expired(Clock::time_point now, std::vector<HttpClient::Connection>& evicted);
+    void evict_oldest(std::vector<HttpClient::Connection>& evicted);
+};
+
+} // namespace conduit
+
+#endif // CONDUIT_CONNECTION_POOL_HPP
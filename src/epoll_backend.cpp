@@ -0,0 +1,318 @@
+#include "io_backend.hpp"
+#include "conduit.hpp"
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace conduit {
+
+namespace {
+    constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+    constexpr int MAX_EVENTS = 256;
+    constexpr int MAX_READS_PER_WAKEUP = 16;
+    constexpr uint64_t WAKE_TOKEN = ~uint64_t{0};
+
+    /**
+     * @brief Readiness-based backend emulating completions on top of epoll
+     *
+     * Sockets are registered once, edge-triggered, for both directions.
+     * Operations started from a callback are never performed inline; the
+     * channel is queued on a ready list and serviced after the current batch
+     * of events, which keeps handlers free of re-entrancy. All channels share
+     * one receive buffer, so an idle connection costs no buffer memory.
+     */
+    class EpollBackend : public IoBackend {
+    public:
+        EpollBackend() : read_buffer_(READ_BUFFER_SIZE) {
+            epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+            if (epoll_fd_ < 0) {
+                throw ConnectionException("Failed to create epoll instance");
+            }
+
+            wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (wake_fd_ < 0) {
+                ::close(epoll_fd_);
+                throw ConnectionException("Failed to create wakeup eventfd");
+            }
+
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = WAKE_TOKEN;
+            epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event);
+        }
+
+        ~EpollBackend() override {
+            for (auto& channel : channels_) {
+                if (channel.fd >= 0) {
+                    ::close(channel.fd);
+                }
+            }
+            ::close(wake_fd_);
+            ::close(epoll_fd_);
+        }
+
+        const char* name() const override { return "epoll"; }
+
+        ChannelId attach(int fd, IoHandler* handler) override {
+            uint32_t index;
+            if (!free_.empty()) {
+                index = free_.back();
+                free_.pop_back();
+            } else {
+                index = static_cast<uint32_t>(channels_.size());
+                channels_.emplace_back();
+            }
+
+            Channel& channel = channels_[index];
+            channel.fd = fd;
+            channel.handler = handler;
+            ChannelId id = make_id(index, channel.generation);
+
+            epoll_event event{};
+            event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+            event.data.u64 = id;
+            if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+                release(index);
+                throw ConnectionException("Failed to register socket with epoll");
+            }
+            return id;
+        }
+
+        void connect(ChannelId id, const sockaddr* addr, socklen_t addr_len) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            channel->connecting = true;
+            if (::connect(channel->fd, addr, addr_len) == 0) {
+                channel->connect_result = 0;
+                enqueue(id);
+            } else if (errno == EINPROGRESS) {
+                channel->connect_result = -1;
+            } else {
+                channel->connect_result = errno;
+                enqueue(id);
+            }
+        }
+
+        void send(ChannelId id, std::shared_ptr<const std::string> data) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            channel->send_buffer = std::move(data);
+            channel->send_offset = 0;
+            enqueue(id);
+        }
+
+        void start_recv(ChannelId id) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            channel->reading = true;
+            enqueue(id);
+        }
+
+        void stop_recv(ChannelId id) override {
+            Channel* channel = lookup(id);
+            if (channel) {
+                channel->reading = false;
+            }
+        }
+
+        void close(ChannelId id) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, channel->fd, nullptr);
+            ::close(channel->fd);
+            release(index_of(id));
+        }
+
+        void poll(int timeout_ms) override {
+            if (!ready_.empty()) {
+                timeout_ms = 0;
+            }
+
+            epoll_event events[MAX_EVENTS];
+            int count = epoll_wait(epoll_fd_, events, MAX_EVENTS, timeout_ms);
+            if (count < 0 && errno != EINTR) {
+                throw ConnectionException("epoll_wait failed");
+            }
+
+            for (int i = 0; i < count; ++i) {
+                if (events[i].data.u64 == WAKE_TOKEN) {
+                    uint64_t value;
+                    while (read(wake_fd_, &value, sizeof(value)) > 0) {}
+                    continue;
+                }
+                if (lookup(events[i].data.u64)) {
+                    service(events[i].data.u64, events[i].events, true);
+                }
+            }
+
+            // Channels with work queued by handlers or left over from a
+            // capped read loop; anything queued while draining waits for
+            // the next poll so one busy socket cannot starve the rest
+            draining_.swap(ready_);
+            for (ChannelId id : draining_) {
+                Channel* channel = lookup(id);
+                if (channel) {
+                    channel->queued = false;
+                    service(id, EPOLLIN | EPOLLOUT, false);
+                }
+            }
+            draining_.clear();
+        }
+
+        void wake() override {
+            uint64_t value = 1;
+            ssize_t written = write(wake_fd_, &value, sizeof(value));
+            (void)written;
+        }
+
+    private:
+        struct Channel {
+            int fd = -1;
+            IoHandler* handler = nullptr;
+            uint32_t generation = 0;
+            bool queued = false;
+            bool connecting = false;
+            int connect_result = -1;
+            std::shared_ptr<const std::string> send_buffer;
+            size_t send_offset = 0;
+            bool reading = false;
+        };
+
+        int epoll_fd_;
+        int wake_fd_;
+        std::deque<Channel> channels_;
+        std::vector<uint32_t> free_;
+        std::vector<ChannelId> ready_;
+        std::vector<ChannelId> draining_;
+        std::vector<char> read_buffer_;
+
+        static ChannelId make_id(uint32_t index, uint32_t generation) {
+            return (static_cast<uint64_t>(generation) << 32) | index;
+        }
+
+        static uint32_t index_of(ChannelId id) {
+            return static_cast<uint32_t>(id & 0xffffffffu);
+        }
+
+        Channel* lookup(ChannelId id) {
+            uint32_t index = index_of(id);
+            if (index >= channels_.size()) return nullptr;
+            Channel& channel = channels_[index];
+            if (!channel.handler || channel.generation != static_cast<uint32_t>(id >> 32)) {
+                return nullptr;
+            }
+            return &channel;
+        }
+
+        void release(uint32_t index) {
+            Channel& channel = channels_[index];
+            uint32_t generation = channel.generation + 1;
+            channel = Channel{};
+            channel.generation = generation;
+            free_.push_back(index);
+        }
+
+        void enqueue(ChannelId id) {
+            Channel* channel = lookup(id);
+            if (channel && !channel->queued) {
+                channel->queued = true;
+                ready_.push_back(id);
+            }
+        }
+
+        /**
+         * @brief Advance whatever operations the channel has outstanding
+         *
+         * Each handler callback may close the channel (and free the handler),
+         * so the channel is looked up again after every callback.
+         */
+        void service(ChannelId id, uint32_t events, bool from_epoll) {
+            Channel* channel = lookup(id);
+
+            if (channel->connecting) {
+                if (channel->connect_result < 0) {
+                    if (!from_epoll || !(events & (EPOLLOUT | EPOLLERR | EPOLLHUP))) {
+                        return;
+                    }
+                    int error = 0;
+                    socklen_t length = sizeof(error);
+                    getsockopt(channel->fd, SOL_SOCKET, SO_ERROR, &error, &length);
+                    channel->connect_result = error;
+                }
+
+                int result = channel->connect_result;
+                channel->connecting = false;
+                channel->connect_result = -1;
+                channel->handler->on_connect(id, result);
+                if (!(channel = lookup(id))) return;
+            }
+
+            if (channel->send_buffer && (events & (EPOLLOUT | EPOLLERR | EPOLLHUP))) {
+                const std::string& buffer = *channel->send_buffer;
+                ssize_t result = 0;
+                while (channel->send_offset < buffer.size()) {
+                    ssize_t sent = ::send(channel->fd, buffer.data() + channel->send_offset,
+                                          buffer.size() - channel->send_offset, MSG_NOSIGNAL);
+                    if (sent > 0) {
+                        channel->send_offset += static_cast<size_t>(sent);
+                    } else if (sent < 0 && errno == EINTR) {
+                        continue;
+                    } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                        break;
+                    } else {
+                        result = sent < 0 ? -errno : -EPIPE;
+                        break;
+                    }
+                }
+
+                if (result < 0 || channel->send_offset == buffer.size()) {
+                    if (result == 0) {
+                        result = static_cast<ssize_t>(buffer.size());
+                    }
+                    channel->send_buffer.reset();
+                    channel->handler->on_send(result);
+                    if (!(channel = lookup(id))) return;
+                }
+            }
+
+            if (channel->reading && (events & (EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP))) {
+                for (int i = 0; i < MAX_READS_PER_WAKEUP; ++i) {
+                    ssize_t received = ::recv(channel->fd, read_buffer_.data(), read_buffer_.size(), 0);
+                    if (received < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                        return;
+                    }
+                    if (received < 0) {
+                        received = -errno;
+                    }
+                    if (received <= 0) {
+                        channel->reading = false;
+                    }
+
+                    channel->handler->on_recv(read_buffer_.data(), received);
+                    if (!(channel = lookup(id)) || !channel->reading) return;
+                }
+
+                // Edge-triggered: the socket may still hold data
+                enqueue(id);
+            }
+        }
+    };
+} // anonymous namespace
+
+std::unique_ptr<IoBackend> make_epoll_backend() {
+    return std::make_unique<EpollBackend>();
+}
+
+} // namespace conduit
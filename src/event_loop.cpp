@@ -0,0 +1,164 @@
+#include "event_loop.hpp"
+
+namespace conduit {
+
+namespace {
+    std::unique_ptr<IoBackend> make_backend(IoBackendType type) {
+        if (type == IoBackendType::IoUring) {
+            try {
+                return make_io_uring_backend();
+            } catch (const ConnectionException&) {
+                // Kernel too old or io_uring disabled: use epoll instead
+            }
+        }
+        return make_epoll_backend();
+    }
+} // anonymous namespace
+
+EventLoop::Impl::Impl(IoBackendType type) : backend_(make_backend(type)) {}
+
+void EventLoop::Impl::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        posted_.push_back(std::move(task));
+    }
+    add_work();
+    backend_->wake();
+}
+
+void EventLoop::Impl::run_posted() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_.swap(posted_);
+    }
+
+    size_t next = 0;
+    try {
+        while (next < running_.size()) {
+            auto task = std::move(running_[next++]);
+            remove_work();
+            task();
+        }
+    } catch (...) {
+        // Keep the tasks that have not run yet, ahead of newer ones
+        std::lock_guard<std::mutex> lock(mutex_);
+        posted_.insert(posted_.begin(), std::make_move_iterator(running_.begin() + next),
+                       std::make_move_iterator(running_.end()));
+        running_.clear();
+        throw;
+    }
+    running_.clear();
+}
+
+TimerWheel::TimerId EventLoop::Impl::add_timer(std::chrono::milliseconds delay, std::function<void()> task) {
+    TimerWheel::TimerId id = timers_.add(delay, std::move(task));
+    add_work();
+    return id;
+}
+
+bool EventLoop::Impl::cancel_timer(TimerWheel::TimerId id) {
+    if (!timers_.cancel(id)) {
+        return false;
+    }
+    remove_work();
+    return true;
+}
+
+void EventLoop::Impl::run_timers() {
+    auto due = timers_.expire(TimerWheel::Clock::now());
+    for (size_t i = 0; i < due.size(); ++i) {
+        remove_work();
+        try {
+            due[i]();
+        } catch (...) {
+            // Expired timers are already out of the wheel; run the rest
+            // on the next pass rather than losing them
+            for (size_t j = i + 1; j < due.size(); ++j) {
+                remove_work();
+                post(std::move(due[j]));
+            }
+            throw;
+        }
+    }
+}
+
+bool EventLoop::Impl::run_once(int timeout_ms) {
+    // Mark the thread so in_loop_thread() lets clients skip post()
+    std::thread::id previous = loop_thread_.exchange(std::this_thread::get_id());
+
+    try {
+        run_posted();
+        bool pending_tasks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_tasks = !posted_.empty();
+        }
+        if (pending_tasks) {
+            timeout_ms = 0;
+        } else {
+            int timer_ms = timers_.next_timeout_ms();
+            if (timer_ms >= 0 && (timeout_ms < 0 || timer_ms < timeout_ms)) {
+                timeout_ms = timer_ms;
+            }
+        }
+        backend_->poll(timeout_ms);
+        run_timers();
+        run_posted();
+    } catch (...) {
+        loop_thread_.store(previous);
+        throw;
+    }
+
+    loop_thread_.store(previous);
+    return has_work();
+}
+
+void EventLoop::Impl::run() {
+    stopped_ = false;
+    while (!stopped_ && has_work()) {
+        run_once(-1);
+    }
+}
+
+void EventLoop::Impl::stop() {
+    stopped_ = true;
+    backend_->wake();
+}
+
+EventLoop::EventLoop(const ClientConfig& config) : impl_(std::make_unique<Impl>(config.io_backend)) {}
+
+EventLoop::~EventLoop() = default;
+
+void EventLoop::run() {
+    impl_->run();
+}
+
+bool EventLoop::run_once(std::chrono::milliseconds timeout) {
+    return impl_->run_once(static_cast<int>(timeout.count()));
+}
+
+EventLoop::TimerId EventLoop::call_after(std::chrono::milliseconds delay, std::function<void()> task) {
+    return impl_->add_timer(delay, std::move(task));
+}
+
+bool EventLoop::cancel_timer(TimerId id) {
+    return impl_->cancel_timer(id);
+}
+
+void EventLoop::stop() {
+    impl_->stop();
+}
+
+void EventLoop::post(std::function<void()> task) {
+    impl_->post(std::move(task));
+}
+
+bool EventLoop::in_loop_thread() const {
+    return impl_->in_loop_thread();
+}
+
+const char* EventLoop::backend_name() const {
+    return impl_->backend().name();
+}
+
+} // namespace conduit
@@ -0,0 +1,58 @@
+#ifndef CONDUIT_EVENT_LOOP_HPP
+#define CONDUIT_EVENT_LOOP_HPP
+
+#include "conduit_async.hpp"
+#include "io_backend.hpp"
+#include "timer_wheel.hpp"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace conduit {
+
+/**
+ * @brief EventLoop internals shared with the asynchronous client
+ *
+ * Outstanding work is counted explicitly: every posted task, pending timer
+ * and in-flight request holds one unit, and run() returns when it drops to
+ * zero. Idle keep-alive sockets hold none.
+ */
+class EventLoop::Impl {
+public:
+    explicit Impl(IoBackendType type);
+
+    IoBackend& backend() { return *backend_; }
+
+    void post(std::function<void()> task);
+    void add_work() { ++work_; }
+    void remove_work() { --work_; }
+    bool has_work() const { return work_.load() > 0; }
+
+    TimerWheel::TimerId add_timer(std::chrono::milliseconds delay, std::function<void()> task);
+    bool cancel_timer(TimerWheel::TimerId id);
+
+    void run();
+    bool run_once(int timeout_ms);
+    void stop();
+    bool in_loop_thread() const { return loop_thread_.load() == std::this_thread::get_id(); }
+
+private:
+    std::unique_ptr<IoBackend> backend_;
+    TimerWheel timers_;
+
+    std::mutex mutex_;
+    std::vector<std::function<void()>> posted_;
+    std::vector<std::function<void()>> running_;
+
+    std::atomic<size_t> work_{0};
+    std::atomic<bool> stopped_{false};
+    std::atomic<std::thread::id> loop_thread_{};
+
+    void run_posted();
+    void run_timers();
+};
+
+} // namespace conduit
+
+#endif // CONDUIT_EVENT_LOOP_HPP
@@ -0,0 +1,108 @@
+#include "conduit.hpp"
+#include <algorithm>
+
+namespace conduit {
+
+namespace {
+    char ascii_lower(char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+    }
+
+    bool iequals(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (ascii_lower(a[i]) != ascii_lower(b[i])) return false;
+        }
+        return true;
+    }
+} // anonymous namespace
+
+bool HeaderName::equals(const HeaderName& other) const {
+    return hash == other.hash && iequals(name, other.name);
+}
+
+HeaderMap::HeaderMap(std::initializer_list<std::pair<std::string_view, std::string_view>> fields) {
+    for (const auto& [name, value] : fields) {
+        add(name, value);
+    }
+}
+
+HeaderMap::HeaderMap(const std::map<std::string, std::string>& fields) {
+    for (const auto& [name, value] : fields) {
+        add(name, value);
+    }
+}
+
+HeaderMap::HeaderMap(HeaderMap&& other) noexcept
+    : block_(std::move(other.block_)), overflow_(std::move(other.overflow_)), size_(other.size_) {
+    std::copy(other.inline_, other.inline_ + std::min(size_, INLINE_FIELDS), inline_);
+    other.clear();
+}
+
+HeaderMap& HeaderMap::operator=(HeaderMap&& other) noexcept {
+    if (this != &other) {
+        block_ = std::move(other.block_);
+        overflow_ = std::move(other.overflow_);
+        size_ = other.size_;
+        std::copy(other.inline_, other.inline_ + std::min(size_, INLINE_FIELDS), inline_);
+        other.clear();
+    }
+    return *this;
+}
+
+void HeaderMap::add(const HeaderName& name, std::string_view value) {
+    Entry e{static_cast<uint32_t>(block_.size()), static_cast<uint32_t>(name.name.size()),
+            static_cast<uint32_t>(value.size()), name.hash};
+    block_.append(name.name).append(": ").append(value).append("\r\n");
+
+    if (size_ < INLINE_FIELDS) {
+        inline_[size_] = e;
+    } else {
+        overflow_.push_back(e);
+    }
+    ++size_;
+}
+
+size_t HeaderMap::find(const HeaderName& name, size_t from) const {
+    // Hashes settle nearly every mismatch without touching the block
+    for (size_t i = from; i < size_; ++i) {
+        const Entry& e = entry(i);
+        if (e.hash == name.hash && e.name_size == name.name.size() &&
+            iequals(std::string_view(block_).substr(e.offset, e.name_size), name.name)) {
+            return i;
+        }
+    }
+    return size_;
+}
+
+std::optional<std::string_view> HeaderMap::get(const HeaderName& name) const {
+    size_t last = size_;
+    for (size_t i = find(name); i < size_; i = find(name, i + 1)) {
+        last = i;
+    }
+    return last < size_ ? std::optional<std::string_view>(field(last).value) : std::nullopt;
+}
+
+std::vector<std::string_view> HeaderMap::get_all(const HeaderName& name) const {
+    std::vector<std::string_view> values;
+    for (size_t i = find(name); i < size_; i = find(name, i + 1)) {
+        values.push_back(field(i).value);
+    }
+    return values;
+}
+
+size_t HeaderMap::count(const HeaderName& name) const {
+    size_t n = 0;
+    for (size_t i = find(name); i < size_; i = find(name, i + 1)) {
+        ++n;
+    }
+    return n;
+}
+
+void HeaderMap::clear() {
+    block_.clear();
+    overflow_.clear();
+    size_ = 0;
+}
+
+} // namespace conduit
@@ -0,0 +1,355 @@
+#include "http_parser.hpp"
+#include "conduit.hpp"
+#include <cstring>
+#include <limits>
+
+namespace conduit {
+
+namespace {
+    char ascii_lower(char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+    }
+
+    /**
+     * @brief ASCII case-insensitive comparison for header names and tokens
+     */
+    bool iequals(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (ascii_lower(a[i]) != ascii_lower(b[i])) return false;
+        }
+        return true;
+    }
+
+    std::string_view trim(std::string_view value) {
+        while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+            value.remove_prefix(1);
+        }
+        while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+            value.remove_suffix(1);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Call fn for every comma separated token in a header value
+     */
+    template <typename Fn>
+    void for_each_token(std::string_view value, Fn&& fn) {
+        while (!value.empty()) {
+            size_t comma = value.find(',');
+            std::string_view token = trim(value.substr(0, comma));
+            if (!token.empty()) {
+                fn(token);
+            }
+            if (comma == std::string_view::npos) break;
+            value.remove_prefix(comma + 1);
+        }
+    }
+
+    /**
+     * @brief Parse a non-negative decimal that fits an int64_t without allocating
+     */
+    bool parse_decimal(std::string_view text, uint64_t& out) {
+        if (text.empty() || text.size() > 19) return false;
+        uint64_t value = 0;
+        for (char c : text) {
+            if (c < '0' || c > '9') return false;
+            value = value * 10 + static_cast<uint64_t>(c - '0');
+        }
+        // 19 digits cannot overflow uint64_t, but may exceed INT64_MAX
+        if (value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) return false;
+        out = value;
+        return true;
+    }
+} // anonymous namespace
+
+void ResponseParser::reset(bool head_request) {
+    state_ = State::StatusLine;
+    scanned_ = 0;
+    header_bytes_ = 0;
+    status_code_ = 0;
+    http_minor_ = 1;
+    headers_.clear();
+    content_length_ = -1;
+    remaining_ = 0;
+    keep_alive_ = true;
+    head_request_ = head_request;
+    has_transfer_encoding_ = false;
+    chunked_ = false;
+}
+
+size_t ResponseParser::feed(const char* data, size_t size, std::string_view& body) {
+    body = std::string_view();
+    size_t pos = 0;
+
+    while (pos < size) {
+        switch (state_) {
+            case State::Body:
+            case State::ChunkData: {
+                size_t take = size - pos;
+                if (remaining_ < take) {
+                    take = static_cast<size_t>(remaining_);
+                }
+                body = std::string_view(data + pos, take);
+                remaining_ -= take;
+                pos += take;
+                if (remaining_ == 0) {
+                    state_ = state_ == State::Body ? State::Complete : State::ChunkDataEnd;
+                }
+                return pos;
+            }
+
+            case State::BodyUntilClose:
+                body = std::string_view(data + pos, size - pos);
+                return size;
+
+            case State::Complete:
+                return pos;
+
+            default: {
+                std::string_view line;
+                size_t used = next_line(data + pos, size - pos, line);
+                if (used == 0) {
+                    return pos;
+                }
+                pos += used;
+                handle_line(line);
+                break;
+            }
+        }
+    }
+
+    return pos;
+}
+
+bool ResponseParser::finish() {
+    if (state_ == State::BodyUntilClose) {
+        state_ = State::Complete;
+        keep_alive_ = false;
+    }
+    return state_ == State::Complete;
+}
+
+size_t ResponseParser::next_line(const char* data, size_t size, std::string_view& line) {
+    bool in_header = state_ == State::StatusLine || state_ == State::Headers || state_ == State::Trailers;
+    size_t limit = in_header ? MAX_HEADER_BYTES - header_bytes_ : MAX_CHUNK_LINE_BYTES;
+
+    const char* newline = static_cast<const char*>(std::memchr(data + scanned_, '\n', size - scanned_));
+    if (!newline) {
+        // Remember how much of the partial line we have seen
+        scanned_ = size;
+        if (scanned_ > limit) {
+            throw ResponseException(in_header ? "Response headers too large" : "Chunk size line too long");
+        }
+        return 0;
+    }
+
+    size_t used = static_cast<size_t>(newline - data) + 1;
+    scanned_ = 0;
+    if (used > limit) {
+        throw ResponseException(in_header ? "Response headers too large" : "Chunk size line too long");
+    }
+    if (in_header) {
+        header_bytes_ += used;
+    }
+
+    line = std::string_view(data, used - 1);
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    return used;
+}
+
+void ResponseParser::handle_line(std::string_view line) {
+    switch (state_) {
+        case State::StatusLine:
+            parse_status_line(line);
+            state_ = State::Headers;
+            break;
+
+        case State::Headers:
+            if (line.empty()) {
+                end_of_headers();
+            } else {
+                parse_header_line(line, false);
+            }
+            break;
+
+        case State::ChunkSize:
+            parse_chunk_size(line);
+            break;
+
+        case State::ChunkDataEnd:
+            if (!line.empty()) {
+                throw ResponseException("Missing CRLF after chunk data");
+            }
+            state_ = State::ChunkSize;
+            break;
+
+        case State::Trailers:
+            if (line.empty()) {
+                state_ = State::Complete;
+            } else {
+                parse_header_line(line, true);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void ResponseParser::parse_status_line(std::string_view line) {
+    // HTTP/1.x SP 3DIGIT [SP reason-phrase]
+    if (line.size() < 12 || line.compare(0, 7, "HTTP/1.") != 0 || line[8] != ' ') {
+        throw ResponseException("Invalid HTTP status line format");
+    }
+
+    http_minor_ = line[7] - '0';
+    if (http_minor_ < 0 || http_minor_ > 9) {
+        throw ResponseException("Invalid HTTP status line format");
+    }
+    keep_alive_ = http_minor_ >= 1;
+
+    int code = 0;
+    for (size_t i = 9; i < 12; ++i) {
+        char c = line[i];
+        if (c < '0' || c > '9') {
+            throw ResponseException("Invalid HTTP status code");
+        }
+        code = code * 10 + (c - '0');
+    }
+    if (line.size() > 12 && line[12] != ' ') {
+        throw ResponseException("Invalid HTTP status code");
+    }
+    status_code_ = code;
+}
+
+void ResponseParser::parse_header_line(std::string_view line, bool trailer) {
+    size_t colon = line.find(':');
+    if (colon == std::string_view::npos) {
+        return;
+    }
+
+    HeaderName name(line.substr(0, colon));
+    std::string_view value = trim(line.substr(colon + 1));
+
+    // Framing fields are only meaningful in the header section; the hash
+    // rules out most names before any comparison
+    if (!trailer) {
+        if (name.equals(header::content_length)) {
+            uint64_t length;
+            if (!parse_decimal(value, length)) {
+                throw ResponseException("Invalid Content-Length");
+            }
+            if (content_length_ >= 0 && static_cast<uint64_t>(content_length_) != length) {
+                throw ResponseException("Conflicting Content-Length headers");
+            }
+            content_length_ = static_cast<int64_t>(length);
+        } else if (name.equals(header::transfer_encoding)) {
+            // Codings are applied in order; the message is chunk-framed
+            // only when chunked is the final one
+            has_transfer_encoding_ = true;
+            chunked_ = false;
+            for_each_token(value, [this](std::string_view coding) {
+                chunked_ = iequals(coding, "chunked");
+            });
+        } else if (name.equals(header::connection)) {
+            for_each_token(value, [this](std::string_view option) {
+                if (iequals(option, "close")) {
+                    keep_alive_ = false;
+                } else if (iequals(option, "keep-alive") && http_minor_ == 0) {
+                    keep_alive_ = true;
+                }
+            });
+        }
+    }
+
+    headers_.add(name, value);
+}
+
+void ResponseParser::parse_chunk_size(std::string_view line) {
+    uint64_t size = 0;
+    size_t digits = 0;
+    for (char c : line) {
+        int nibble;
+        if (c >= '0' && c <= '9') {
+            nibble = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            nibble = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            nibble = c - 'A' + 10;
+        } else {
+            break;
+        }
+        if (++digits > 15) {
+            throw ResponseException("Chunk size too large");
+        }
+        size = (size << 4) | static_cast<uint64_t>(nibble);
+    }
+
+    // Anything after the digits must be whitespace or a chunk extension
+    std::string_view rest = trim(line.substr(digits));
+    if (digits == 0 || (!rest.empty() && rest.front() != ';')) {
+        throw ResponseException("Invalid chunk size");
+    }
+
+    if (size == 0) {
+        state_ = State::Trailers;
+    } else {
+        remaining_ = size;
+        state_ = State::ChunkData;
+    }
+}
+
+void ResponseParser::end_of_headers() {
+    // Interim responses precede the real one on the same stream
+    if (status_code_ >= 100 && status_code_ < 200 && status_code_ != 101) {
+        state_ = State::StatusLine;
+        headers_.clear();
+        content_length_ = -1;
+        has_transfer_encoding_ = false;
+        chunked_ = false;
+        return;
+    }
+
+    if (status_code_ == 101) {
+        // The stream now speaks another protocol
+        keep_alive_ = false;
+        state_ = State::Complete;
+        return;
+    }
+
+    if (head_request_ || status_code_ == 204 || status_code_ == 304) {
+        state_ = State::Complete;
+        return;
+    }
+
+    if (has_transfer_encoding_) {
+        if (content_length_ >= 0) {
+            // Both framings present: trust Transfer-Encoding, but the stream
+            // cannot be trusted for another message afterwards
+            content_length_ = -1;
+            keep_alive_ = false;
+        }
+        if (chunked_) {
+            state_ = State::ChunkSize;
+        } else {
+            state_ = State::BodyUntilClose;
+            keep_alive_ = false;
+        }
+        return;
+    }
+
+    if (content_length_ >= 0) {
+        remaining_ = static_cast<uint64_t>(content_length_);
+        state_ = remaining_ == 0 ? State::Complete : State::Body;
+        return;
+    }
+
+    state_ = State::BodyUntilClose;
+    keep_alive_ = false;
+}
+
+} // namespace conduit
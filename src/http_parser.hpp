@@ -0,0 +1,116 @@
+#ifndef CONDUIT_HTTP_PARSER_HPP
+#define CONDUIT_HTTP_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "conduit.hpp"
+
+namespace conduit {
+
+/**
+ * @brief Resumable, push-style HTTP/1.1 response parser
+ *
+ * The caller owns the receive buffer and presents the unconsumed bytes to
+ * feed() every time more data arrives. The parser consumes complete lines
+ * only, so a partial header line stays in the caller's buffer; it remembers
+ * how far into that line it already scanned and never looks at those bytes
+ * again. Body bytes are handed back as views into the caller's buffer.
+ *
+ * Framing follows RFC 9112 section 6.3: a chunked Transfer-Encoding wins
+ * over Content-Length, HEAD replies and 1xx/204/304 statuses carry no body,
+ * and anything else without a length is read until the peer closes. Chunk
+ * extensions are skipped and trailer fields are appended to the headers.
+ * Header fields are copied once, into the parser's HeaderMap.
+ */
+class ResponseParser {
+public:
+    enum class State {
+        StatusLine,
+        Headers,
+        Body,
+        ChunkSize,
+        ChunkData,
+        ChunkDataEnd,
+        Trailers,
+        BodyUntilClose,
+        Complete
+    };
+
+    // Upper bound on the status line plus header block (and trailers)
+    static constexpr size_t MAX_HEADER_BYTES = 64 * 1024;
+
+    // Upper bound on a chunk-size line including extensions
+    static constexpr size_t MAX_CHUNK_LINE_BYTES = 4 * 1024;
+
+    ResponseParser() = default;
+
+    /**
+     * @brief Prepare for the next response on the same stream
+     * @param head_request The response answers a HEAD request and has no body
+     */
+    void reset(bool head_request = false);
+
+    /**
+     * @brief Consume as much of [data, data + size) as possible
+     * @param body Set to the body bytes consumed by this call, if any
+     * @return Number of bytes consumed; unconsumed bytes must be presented
+     *         again, unchanged, at the start of the next call
+     *
+     * Returns after at most one body span so the caller can hand it off
+     * before parsing continues. Throws ResponseException on malformed input.
+     */
+    size_t feed(const char* data, size_t size, std::string_view& body);
+
+    /**
+     * @brief Signal that the peer closed the stream
+     * @return true if this completed the response
+     */
+    bool finish();
+
+    State state() const { return state_; }
+    bool complete() const { return state_ == State::Complete; }
+    bool headers_complete() const { return state_ != State::StatusLine && state_ != State::Headers; }
+    bool chunked() const { return chunked_; }
+    bool started() const { return header_bytes_ > 0 || scanned_ > 0; }
+
+    int status_code() const { return status_code_; }
+    HeaderMap& headers() { return headers_; }
+
+    /**
+     * @brief Declared Content-Length, or -1 when the body is not length-delimited
+     */
+    int64_t content_length() const { return content_length_; }
+
+    /**
+     * @brief Whether the stream can carry another request after this response
+     */
+    bool keep_alive() const { return keep_alive_; }
+
+private:
+    State state_ = State::StatusLine;
+    size_t scanned_ = 0;
+    size_t header_bytes_ = 0;
+
+    int status_code_ = 0;
+    int http_minor_ = 1;
+    HeaderMap headers_;
+    int64_t content_length_ = -1;
+    uint64_t remaining_ = 0;
+    bool keep_alive_ = true;
+    bool head_request_ = false;
+    bool has_transfer_encoding_ = false;
+    bool chunked_ = false;
+
+    size_t next_line(const char* data, size_t size, std::string_view& line);
+    void handle_line(std::string_view line);
+    void parse_status_line(std::string_view line);
+    void parse_header_line(std::string_view line, bool trailer);
+    void parse_chunk_size(std::string_view line);
+    void end_of_headers();
+};
+
+} // namespace conduit
+
+#endif // CONDUIT_HTTP_PARSER_HPP
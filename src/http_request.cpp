@@ -0,0 +1,113 @@
+#include "http_request.hpp"
+#include <charconv>
+
+namespace conduit {
+
+namespace {
+    /**
+     * @brief The Host line; IPv6 literals go back in brackets
+     */
+    void append_host(std::string& out, const std::string& hostname) {
+        out.append("Host: ");
+        if (hostname.find(':') != std::string::npos) {
+            out.append("[").append(hostname).append("]\r\n");
+        } else {
+            out.append(hostname).append("\r\n");
+        }
+    }
+
+    /**
+     * @brief The request's headers minus those the defaults or content_type replace
+     */
+    void append_own_headers(std::string& out, const HeaderMap& defaults, const HeaderMap& headers,
+                            std::string_view content_type) {
+        if (!content_type.empty() && !defaults.contains(header::content_type)) {
+            out.append("Content-Type: ").append(content_type).append("\r\n");
+        }
+
+        // Usually nothing is replaced and the block goes in whole
+        auto replaced = [&](std::string_view name) {
+            HeaderName field(name);
+            return defaults.contains(field) || (!content_type.empty() && field.equals(header::content_type));
+        };
+        bool whole = true;
+        for (const auto& field : headers) {
+            if (replaced(field.name)) {
+                whole = false;
+                break;
+            }
+        }
+        if (whole) {
+            out.append(headers.block());
+            return;
+        }
+        for (const auto& field : headers) {
+            if (!replaced(field.name)) {
+                out.append(field.name).append(": ").append(field.value).append("\r\n");
+            }
+        }
+    }
+} // anonymous namespace
+
+bool is_idempotent(std::string_view method) {
+    return method == "GET" || method == "HEAD" || method == "OPTIONS" || method == "TRACE" ||
+           method == "PUT" || method == "DELETE";
+}
+
+void RequestParts::gather(std::vector<iovec>& buffers) const {
+    auto add = [&buffers](const char* data, size_t size) {
+        if (size > 0) {
+            buffers.push_back(iovec{const_cast<char*>(data), size});
+        }
+    };
+    add(text.data(), split);
+    add(defaults.data(), defaults.size());
+    add(text.data() + split, text.size() - split);
+    add(body.data(), body.size());
+}
+
+void build_http_request(const std::string& method, const std::string& path, const std::string& hostname,
+                        const HeaderMap& defaults, const HeaderMap& headers, std::string_view content_type,
+                        std::string_view body, RequestParts& out) {
+    std::string& text = out.text;
+    text.clear();
+    text.append(method).append(" ").append(path).append(" HTTP/1.1\r\n");
+    append_host(text, hostname);
+    out.split = text.size();
+    out.defaults = defaults.block();
+
+    append_own_headers(text, defaults, headers, content_type);
+    if (!body.empty()) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), body.size());
+        text.append("Content-Length: ").append(digits, result.ptr).append("\r\n");
+    }
+    text.append("\r\n");
+    out.body = body;
+}
+
+std::string render_request_tail(const std::string& hostname, const HeaderMap& defaults, const HeaderMap& headers) {
+    std::string tail;
+    tail.append(" HTTP/1.1\r\n");
+    append_host(tail, hostname);
+    tail.append(defaults.block());
+    append_own_headers(tail, defaults, headers, {});
+    return tail;
+}
+
+std::string build_http_request(const std::string& method, const std::string& path, const std::string& hostname,
+                               const HeaderMap& defaults, const HeaderMap& headers, std::string_view content_type,
+                               std::string_view body) {
+    RequestParts parts;
+    build_http_request(method, path, hostname, defaults, headers, content_type, body, parts);
+
+    std::string wire;
+    wire.reserve(parts.size());
+    wire.append(parts.text, 0, parts.split);
+    wire.append(parts.defaults);
+    wire.append(parts.text, parts.split, std::string::npos);
+    wire.append(parts.body);
+    return wire;
+}
+
+} // namespace conduit
@@ -0,0 +1,69 @@
+#ifndef CONDUIT_HTTP_REQUEST_HPP
+#define CONDUIT_HTTP_REQUEST_HPP
+
+#include "conduit.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sys/uio.h>
+
+namespace conduit {
+
+/**
+ * @brief An HTTP/1.1 request as the pieces one sendmsg() gathers
+ *
+ * Only the request line, Host, the request's own headers and
+ * Content-Length are formatted per request, all into text. The default
+ * header block and the body are referenced where they already live and
+ * must outlive the send.
+ */
+struct RequestParts {
+    std::string text;           // request line and Host, then the rest of the head
+    size_t split = 0;           // where the default header block goes in text
+    std::string_view defaults;
+    std::string_view body;
+
+    size_t size() const { return text.size() + defaults.size() + body.size(); }
+
+    /**
+     * @brief Append the non-empty pieces to buffers, in wire order
+     */
+    void gather(std::vector<iovec>& buffers) const;
+};
+
+/**
+ * @brief Methods that may be repeated and pipelined (RFC 9110 section 9.2.2)
+ */
+bool is_idempotent(std::string_view method);
+
+/**
+ * @brief Lay out a request around the block of the default headers
+ *
+ * Shared by the blocking Connection and the asynchronous client so both
+ * put identical bytes on the wire. A request header that is also among the
+ * defaults, compared without regard to case, is dropped, so the default
+ * value is sent. A non-empty content_type is sent as Content-Type in place
+ * of any the request headers carry.
+ */
+void build_http_request(const std::string& method, const std::string& path, const std::string& hostname,
+                        const HeaderMap& defaults, const HeaderMap& headers, std::string_view content_type,
+                        std::string_view body, RequestParts& out);
+
+/**
+ * @brief Everything after the request target, for RequestTemplate
+ *
+ * The version, Host, the default block and the request's own headers,
+ * laid out as build_http_request() would, without the closing blank line.
+ */
+std::string render_request_tail(const std::string& hostname, const HeaderMap& defaults, const HeaderMap& headers);
+
+/**
+ * @brief The same request in one string, for senders that must own the bytes
+ */
+std::string build_http_request(const std::string& method, const std::string& path, const std::string& hostname,
+                               const HeaderMap& defaults, const HeaderMap& headers, std::string_view content_type,
+                               std::string_view body);
+
+} // namespace conduit
+
+#endif // CONDUIT_HTTP_REQUEST_HPP
@@ -0,0 +1,106 @@
+#ifndef CONDUIT_IO_BACKEND_HPP
+#define CONDUIT_IO_BACKEND_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+namespace conduit {
+
+/**
+ * @brief Identifies a socket registered with an IoBackend
+ *
+ * The low half indexes the backend's channel table, the high half is a
+ * generation counter so completions for a closed channel are never routed
+ * to whoever reuses its slot.
+ */
+using ChannelId = uint64_t;
+
+/**
+ * @brief Receiver of completions for one non-blocking socket
+ *
+ * Callbacks always run on the event loop thread, never from inside the
+ * IoBackend call that started the operation.
+ */
+class IoHandler {
+public:
+    virtual ~IoHandler() = default;
+
+    /**
+     * @param channel The connecting socket, for handlers racing several
+     * @param error 0 on success, otherwise an errno value
+     */
+    virtual void on_connect(ChannelId channel, int error) = 0;
+
+    /**
+     * @param result Bytes written (the whole buffer) or -errno
+     */
+    virtual void on_send(ssize_t result) = 0;
+
+    /**
+     * @param data Received bytes, valid only for the duration of the call
+     * @param result Number of bytes, 0 at end of stream, or -errno
+     */
+    virtual void on_recv(const char* data, ssize_t result) = 0;
+};
+
+/**
+ * @brief Completion-style socket I/O used by the EventLoop
+ *
+ * Every operation completes through the channel's IoHandler. Receiving is
+ * "multishot": once started, on_recv fires for every batch of data until
+ * stop_recv(), end of stream or an error. At most one send per channel may
+ * be outstanding; the backend holds a reference to its buffer for as long
+ * as the kernel may read it, which can be past close().
+ */
+class IoBackend {
+public:
+    virtual ~IoBackend() = default;
+
+    virtual const char* name() const = 0;
+
+    /**
+     * @brief Take ownership of a non-blocking socket
+     */
+    virtual ChannelId attach(int fd, IoHandler* handler) = 0;
+
+    virtual void connect(ChannelId id, const sockaddr* addr, socklen_t addr_len) = 0;
+    virtual void send(ChannelId id, std::shared_ptr<const std::string> data) = 0;
+    virtual void start_recv(ChannelId id) = 0;
+    virtual void stop_recv(ChannelId id) = 0;
+
+    /**
+     * @brief Close the socket; no callback for this channel runs afterwards
+     *
+     * The handler may be destroyed as soon as close() returns, including
+     * from inside one of its own callbacks.
+     */
+    virtual void close(ChannelId id) = 0;
+
+    /**
+     * @brief Wait up to timeout_ms (-1 for no limit) and dispatch completions
+     */
+    virtual void poll(int timeout_ms) = 0;
+
+    /**
+     * @brief Interrupt a concurrent poll(); safe from any thread
+     */
+    virtual void wake() = 0;
+};
+
+std::unique_ptr<IoBackend> make_epoll_backend();
+
+/**
+ * @brief Create the io_uring backend
+ *
+ * Throws ConnectionException if the running kernel (or the build) lacks
+ * the io_uring features it relies on.
+ */
+std::unique_ptr<IoBackend> make_io_uring_backend();
+
+} // namespace conduit
+
+#endif // CONDUIT_IO_BACKEND_HPP
@@ -0,0 +1,681 @@
+#include "io_backend.hpp"
+#include "conduit.hpp"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define CONDUIT_HAVE_IO_URING 1
+#endif
+
+#ifdef CONDUIT_HAVE_IO_URING
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace conduit {
+
+namespace {
+    constexpr unsigned RING_ENTRIES = 256;
+    constexpr unsigned RECV_BUFFER_COUNT = 64;     // power of two
+    constexpr size_t RECV_BUFFER_SIZE = 16 * 1024;
+    constexpr uint16_t RECV_BUFFER_GROUP = 0;
+
+    // user_data layout: generation << 32 | channel index << 2 | operation
+    enum Operation : uint64_t { OpConnect = 0, OpSend = 1, OpRecv = 2 };
+    constexpr uint64_t WAKE_TOKEN = ~uint64_t{0};
+    constexpr uint64_t CANCEL_TOKEN = ~uint64_t{0} - 1;
+
+    int sys_io_uring_setup(unsigned entries, io_uring_params* params) {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags,
+                           const void* arg, size_t arg_size) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, arg_size));
+    }
+
+    int sys_io_uring_register(int fd, unsigned opcode, const void* arg, unsigned count) {
+        return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, count));
+    }
+
+    /**
+     * @brief Completion-based backend on io_uring
+     *
+     * Operations are queued as SQEs and submitted in one io_uring_enter()
+     * per poll(), which also waits for completions, so a busy loop costs
+     * one syscall per iteration no matter how many sockets it drives.
+     * Receives are multishot and select from a ring of buffers registered
+     * with the kernel: data lands directly in the buffer handed to
+     * on_recv() and the buffer is returned to the ring as soon as the
+     * handler is done with it.
+     *
+     * Needs Linux 6.0 (multishot receive). The constructor throws
+     * ConnectionException when the kernel lacks anything required, and the
+     * caller falls back to epoll.
+     */
+    class IoUringBackend : public IoBackend {
+    public:
+        IoUringBackend() {
+            io_uring_params params{};
+            params.flags = IORING_SETUP_CLAMP | IORING_SETUP_SUBMIT_ALL |
+                           IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG;
+            ring_fd_ = sys_io_uring_setup(RING_ENTRIES, &params);
+            if (ring_fd_ < 0 && errno == EINVAL) {
+                params = io_uring_params{};
+                params.flags = IORING_SETUP_CLAMP;
+                ring_fd_ = sys_io_uring_setup(RING_ENTRIES, &params);
+            }
+            if (ring_fd_ < 0) {
+                throw ConnectionException("io_uring is not available");
+            }
+
+            try {
+                constexpr unsigned required = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP |
+                                              IORING_FEAT_FAST_POLL | IORING_FEAT_EXT_ARG;
+                if ((params.features & required) != required) {
+                    throw ConnectionException("io_uring lacks required features");
+                }
+                check_opcodes();
+                map_rings(params);
+                setup_recv_buffers();
+                setup_wakeup();
+            } catch (...) {
+                cleanup();
+                throw;
+            }
+        }
+
+        ~IoUringBackend() override {
+            for (uint32_t index = 0; index < channels_.size(); ++index) {
+                if (channels_[index].handler) {
+                    close(make_id(index, channels_[index].generation));
+                }
+            }
+            // Closing the ring does not wait for the kernel to stop reading
+            // send buffers, so reap those sends first. Their sockets are
+            // shut down, so none of them can block.
+            while (draining_ > 0) {
+                submit(1, 100);
+                drain_completions();
+            }
+            cleanup();
+        }
+
+        const char* name() const override { return "io_uring"; }
+
+        ChannelId attach(int fd, IoHandler* handler) override {
+            uint32_t index;
+            if (!free_.empty()) {
+                index = free_.back();
+                free_.pop_back();
+            } else {
+                index = static_cast<uint32_t>(channels_.size());
+                channels_.emplace_back();
+            }
+
+            Channel& channel = channels_[index];
+            channel.fd = fd;
+            channel.handler = handler;
+            return make_id(index, channel.generation);
+        }
+
+        void connect(ChannelId id, const sockaddr* addr, socklen_t addr_len) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            // The kernel reads the address when the SQE is submitted
+            std::memcpy(&channel->address, addr, addr_len);
+            channel->connecting = true;
+
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = IORING_OP_CONNECT;
+            sqe->fd = channel->fd;
+            sqe->addr = reinterpret_cast<uint64_t>(&channel->address);
+            sqe->off = addr_len;
+            sqe->user_data = token(id, OpConnect);
+            commit_sqe();
+        }
+
+        void send(ChannelId id, std::shared_ptr<const std::string> data) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            channel->send_buffer = std::move(data);
+            channel->send_offset = 0;
+            queue_send(id, *channel);
+        }
+
+        void start_recv(ChannelId id) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            channel->reading = true;
+            if (!channel->recv_armed) {
+                arm_recv(id, *channel);
+            }
+        }
+
+        void stop_recv(ChannelId id) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            channel->reading = false;
+            if (channel->recv_armed) {
+                queue_cancel(token(id, OpRecv));
+            }
+        }
+
+        void close(ChannelId id) override {
+            Channel* channel = lookup(id);
+            if (!channel) return;
+
+            // Pending operations hold their own reference to the socket, so
+            // they are cancelled by user_data rather than by descriptor,
+            // which may be reused as soon as it is closed
+            if (channel->connecting) queue_cancel(token(id, OpConnect));
+            if (channel->recv_armed) queue_cancel(token(id, OpRecv));
+            if (channel->send_buffer) {
+                // A send already running is not stopped by the cancel, and
+                // either way the kernel is done with the buffer only when
+                // the send's own completion arrives. Until then the slot
+                // keeps the socket and its reference to the buffer, and the
+                // shutdown makes sure that completion comes promptly.
+                queue_cancel(token(id, OpSend));
+                shutdown(channel->fd, SHUT_RDWR);
+                channel->handler = nullptr;
+                channel->draining = true;
+                ++draining_;
+                return;
+            }
+
+            ::close(channel->fd);
+            release(index_of(id));
+        }
+
+        void poll(int timeout_ms) override {
+            bool have_completions = cq_ready() > 0 || !completions_.empty();
+            unsigned wait = (timeout_ms == 0 || have_completions) ? 0 : 1;
+            submit(wait, timeout_ms);
+            drain_completions();
+        }
+
+        void wake() override {
+            uint64_t value = 1;
+            ssize_t written = write(wake_fd_, &value, sizeof(value));
+            (void)written;
+        }
+
+    private:
+        struct Channel {
+            int fd = -1;
+            IoHandler* handler = nullptr;
+            uint32_t generation = 0;
+            sockaddr_storage address{};
+            bool connecting = false;
+            std::shared_ptr<const std::string> send_buffer;
+            size_t send_offset = 0;
+            bool draining = false;      // closed, waiting for the send to complete
+            bool reading = false;
+            bool recv_armed = false;
+        };
+
+        int ring_fd_ = -1;
+        int wake_fd_ = -1;
+
+        void* sq_ring_ = nullptr;
+        size_t sq_ring_size_ = 0;
+        io_uring_sqe* sqes_ = nullptr;
+        size_t sqes_size_ = 0;
+        unsigned* sq_head_ = nullptr;
+        unsigned* sq_tail_ = nullptr;
+        unsigned* sq_flags_ = nullptr;
+        unsigned* sq_array_ = nullptr;
+        unsigned sq_mask_ = 0;
+        unsigned sq_entries_ = 0;
+
+        unsigned* cq_head_ = nullptr;
+        unsigned* cq_tail_ = nullptr;
+        io_uring_cqe* cqes_ = nullptr;
+        unsigned cq_mask_ = 0;
+
+        // The kernel header's flexible array member is laid out differently
+        // when compiled as C++, so the ring is addressed as a plain array
+        // whose first entry's resv field doubles as the tail
+        io_uring_buf* buf_ring_ = nullptr;
+        size_t buf_ring_size_ = 0;
+        char* recv_buffers_ = nullptr;
+        uint16_t buf_tail_ = 0;
+        bool buf_ring_registered_ = false;
+
+        std::deque<Channel> channels_;
+        std::vector<uint32_t> free_;
+        size_t draining_ = 0;
+        std::deque<io_uring_cqe> completions_;     // reaped, not yet dispatched
+
+        static ChannelId make_id(uint32_t index, uint32_t generation) {
+            return (static_cast<uint64_t>(generation) << 32) | index;
+        }
+
+        static uint32_t index_of(ChannelId id) {
+            return static_cast<uint32_t>(id & 0xffffffffu);
+        }
+
+        static uint64_t token(ChannelId id, Operation op) {
+            return (id & 0xffffffff00000000ull) | (static_cast<uint64_t>(index_of(id)) << 2) | op;
+        }
+
+        Channel* lookup(ChannelId id) {
+            uint32_t index = index_of(id);
+            if (index >= channels_.size()) return nullptr;
+            Channel& channel = channels_[index];
+            if (!channel.handler || channel.generation != static_cast<uint32_t>(id >> 32)) {
+                return nullptr;
+            }
+            return &channel;
+        }
+
+        void release(uint32_t index) {
+            Channel& channel = channels_[index];
+            uint32_t generation = channel.generation + 1;
+            channel = Channel{};
+            channel.generation = generation;
+            free_.push_back(index);
+        }
+
+        void check_opcodes() {
+            constexpr unsigned OPS = 256;
+            std::vector<char> storage(sizeof(io_uring_probe) + OPS * sizeof(io_uring_probe_op), 0);
+            auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+            if (sys_io_uring_register(ring_fd_, IORING_REGISTER_PROBE, probe, OPS) < 0) {
+                throw ConnectionException("io_uring opcode probe failed");
+            }
+
+            // SEND_ZC arrived in the same release as multishot receive, which
+            // cannot be probed for directly
+            for (unsigned op : {IORING_OP_CONNECT, IORING_OP_SEND, IORING_OP_RECV, IORING_OP_POLL_ADD,
+                                IORING_OP_ASYNC_CANCEL, IORING_OP_SEND_ZC}) {
+                if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                    throw ConnectionException("io_uring lacks a required opcode");
+                }
+            }
+        }
+
+        void map_rings(const io_uring_params& params) {
+            size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            sq_ring_size_ = std::max(sq_size, cq_size);
+
+            sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            ring_fd_, IORING_OFF_SQ_RING);
+            if (sq_ring_ == MAP_FAILED) {
+                sq_ring_ = nullptr;
+                throw ConnectionException("Failed to map io_uring rings");
+            }
+
+            sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+            void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                              ring_fd_, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED) {
+                throw ConnectionException("Failed to map io_uring submission entries");
+            }
+            sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+            char* base = static_cast<char*>(sq_ring_);
+            sq_head_ = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+            sq_tail_ = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+            sq_flags_ = reinterpret_cast<unsigned*>(base + params.sq_off.flags);
+            sq_array_ = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+            sq_mask_ = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+            sq_entries_ = params.sq_entries;
+
+            cq_head_ = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+            cq_tail_ = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+            cqes_ = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+            cq_mask_ = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+        }
+
+        void setup_recv_buffers() {
+            buf_ring_size_ = RECV_BUFFER_COUNT * sizeof(io_uring_buf);
+            void* ring = mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ring == MAP_FAILED) {
+                throw ConnectionException("Failed to allocate io_uring buffer ring");
+            }
+            buf_ring_ = static_cast<io_uring_buf*>(ring);
+
+            void* buffers = mmap(nullptr, RECV_BUFFER_COUNT * RECV_BUFFER_SIZE, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (buffers == MAP_FAILED) {
+                throw ConnectionException("Failed to allocate io_uring receive buffers");
+            }
+            recv_buffers_ = static_cast<char*>(buffers);
+
+            io_uring_buf_reg reg{};
+            reg.ring_addr = reinterpret_cast<uint64_t>(buf_ring_);
+            reg.ring_entries = RECV_BUFFER_COUNT;
+            reg.bgid = RECV_BUFFER_GROUP;
+            if (sys_io_uring_register(ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+                throw ConnectionException("Failed to register io_uring buffer ring");
+            }
+            buf_ring_registered_ = true;
+
+            for (uint16_t bid = 0; bid < RECV_BUFFER_COUNT; ++bid) {
+                recycle(bid);
+            }
+        }
+
+        void setup_wakeup() {
+            wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (wake_fd_ < 0) {
+                throw ConnectionException("Failed to create wakeup eventfd");
+            }
+            arm_wakeup();
+            submit(0);
+        }
+
+        void cleanup() {
+            if (buf_ring_registered_) {
+                io_uring_buf_reg reg{};
+                reg.bgid = RECV_BUFFER_GROUP;
+                sys_io_uring_register(ring_fd_, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+            }
+            // Closing the ring cancels whatever is still in flight
+            if (ring_fd_ >= 0) ::close(ring_fd_);
+            if (wake_fd_ >= 0) ::close(wake_fd_);
+            if (sqes_) munmap(sqes_, sqes_size_);
+            if (sq_ring_) munmap(sq_ring_, sq_ring_size_);
+            if (buf_ring_) munmap(buf_ring_, buf_ring_size_);
+            if (recv_buffers_) munmap(recv_buffers_, RECV_BUFFER_COUNT * RECV_BUFFER_SIZE);
+        }
+
+        /**
+         * @brief Claim the next submission slot, flushing the queue if full
+         *
+         * The kernel takes no more entries while completions it could not
+         * post are waiting, so room is made in the completion queue too.
+         * Those completions are only dispatched later, from poll().
+         */
+        io_uring_sqe* next_sqe() {
+            while (sq_pending() >= sq_entries_) {
+                submit(0);
+                if (sq_pending() >= sq_entries_) {
+                    reap_completions();
+                }
+            }
+            unsigned tail = *sq_tail_;
+            io_uring_sqe* sqe = &sqes_[tail & sq_mask_];
+            std::memset(sqe, 0, sizeof(*sqe));
+            sq_array_[tail & sq_mask_] = tail & sq_mask_;
+            return sqe;
+        }
+
+        void commit_sqe() {
+            __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+        }
+
+        unsigned sq_pending() const {
+            return *sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        }
+
+        unsigned cq_ready() const {
+            return __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE) - *cq_head_;
+        }
+
+        /**
+         * @brief Submit queued SQEs and optionally wait for completions
+         */
+        void submit(unsigned wait, int timeout_ms = -1) {
+            unsigned to_submit = sq_pending();
+            // Overflowed completions are flushed only by a GETEVENTS enter
+            bool task_work = __atomic_load_n(sq_flags_, __ATOMIC_RELAXED) &
+                             (IORING_SQ_TASKRUN | IORING_SQ_CQ_OVERFLOW);
+            if (to_submit == 0 && wait == 0 && !task_work) {
+                return;
+            }
+
+            unsigned flags = (wait > 0 || task_work) ? IORING_ENTER_GETEVENTS : 0;
+            __kernel_timespec ts{};
+            io_uring_getevents_arg arg{};
+            const void* argp = nullptr;
+            size_t arg_size = 0;
+            if (wait > 0 && timeout_ms >= 0) {
+                ts.tv_sec = timeout_ms / 1000;
+                ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+                arg.sigmask_sz = _NSIG / 8;
+                arg.ts = reinterpret_cast<uint64_t>(&ts);
+                argp = &arg;
+                arg_size = sizeof(arg);
+                flags |= IORING_ENTER_EXT_ARG;
+            }
+
+            while (sys_io_uring_enter(ring_fd_, to_submit, wait, flags, argp, arg_size) < 0) {
+                if (errno == EINTR && to_submit == 0) {
+                    return;
+                }
+                if (errno == ETIME || errno == EBUSY) {
+                    return;
+                }
+                if (errno != EINTR && errno != EAGAIN) {
+                    throw ConnectionException("io_uring_enter failed");
+                }
+                to_submit = sq_pending();
+            }
+        }
+
+        void recycle(uint16_t bid) {
+            io_uring_buf* buf = &buf_ring_[buf_tail_ & (RECV_BUFFER_COUNT - 1)];
+            buf->addr = reinterpret_cast<uint64_t>(recv_buffers_ + bid * RECV_BUFFER_SIZE);
+            buf->len = RECV_BUFFER_SIZE;
+            buf->bid = bid;
+            ++buf_tail_;
+            __atomic_store_n(&buf_ring_[0].resv, buf_tail_, __ATOMIC_RELEASE);
+        }
+
+        void arm_wakeup() {
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = IORING_OP_POLL_ADD;
+            sqe->fd = wake_fd_;
+            sqe->poll32_events = POLLIN;
+            sqe->len = IORING_POLL_ADD_MULTI;
+            sqe->user_data = WAKE_TOKEN;
+            commit_sqe();
+        }
+
+        void arm_recv(ChannelId id, Channel& channel) {
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = IORING_OP_RECV;
+            sqe->fd = channel.fd;
+            sqe->ioprio = IORING_RECV_MULTISHOT;
+            sqe->flags = IOSQE_BUFFER_SELECT;
+            sqe->buf_group = RECV_BUFFER_GROUP;
+            sqe->user_data = token(id, OpRecv);
+            commit_sqe();
+            channel.recv_armed = true;
+        }
+
+        void queue_send(ChannelId id, Channel& channel) {
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = IORING_OP_SEND;
+            sqe->fd = channel.fd;
+            const std::string& buffer = *channel.send_buffer;
+            sqe->addr = reinterpret_cast<uint64_t>(buffer.data() + channel.send_offset);
+            sqe->len = static_cast<uint32_t>(std::min<size_t>(buffer.size() - channel.send_offset, 1u << 30));
+            sqe->msg_flags = MSG_NOSIGNAL;
+            sqe->user_data = token(id, OpSend);
+            commit_sqe();
+        }
+
+        void queue_cancel(uint64_t target) {
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = target;
+            sqe->user_data = CANCEL_TOKEN;
+            commit_sqe();
+        }
+
+        /**
+         * @brief Move every posted completion to completions_, freeing its slot
+         */
+        void reap_completions() {
+            unsigned head = *cq_head_;
+            unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            for (; head != tail; ++head) {
+                completions_.push_back(cqes_[head & cq_mask_]);
+            }
+            __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+        }
+
+        void drain_completions() {
+            // Handlers may submit, and so reap, while this runs; taking
+            // entries from the front keeps them in the order they arrived
+            reap_completions();
+            while (!completions_.empty()) {
+                io_uring_cqe cqe = completions_.front();
+                completions_.pop_front();
+                dispatch(cqe);
+                if (completions_.empty()) {
+                    reap_completions();
+                }
+            }
+        }
+
+        /**
+         * @brief Route one completion to its channel
+         *
+         * Completions for closed channels fail the generation check; their
+         * receive buffers still go back to the ring.
+         */
+        void dispatch(const io_uring_cqe& cqe) {
+            if (cqe.user_data == CANCEL_TOKEN) {
+                return;
+            }
+            if (cqe.user_data == WAKE_TOKEN) {
+                uint64_t value;
+                while (read(wake_fd_, &value, sizeof(value)) > 0) {}
+                if (!(cqe.flags & IORING_CQE_F_MORE)) {
+                    arm_wakeup();
+                }
+                return;
+            }
+
+            auto op = static_cast<Operation>(cqe.user_data & 3);
+            ChannelId id = (cqe.user_data & 0xffffffff00000000ull) | ((cqe.user_data & 0xffffffffu) >> 2);
+            Channel* channel = lookup(id);
+
+            switch (op) {
+            case OpConnect:
+                if (channel && channel->connecting) {
+                    channel->connecting = false;
+                    channel->handler->on_connect(id, cqe.res < 0 ? -cqe.res : 0);
+                }
+                break;
+            case OpSend:
+                if (channel && channel->send_buffer) {
+                    complete_send(id, *channel, cqe.res);
+                } else {
+                    finish_draining(id);
+                }
+                break;
+            case OpRecv:
+                complete_recv(id, channel, cqe);
+                break;
+            }
+        }
+
+        void complete_send(ChannelId id, Channel& channel, int result) {
+            size_t size = channel.send_buffer->size();
+            if (result > 0) {
+                channel.send_offset += static_cast<size_t>(result);
+                if (channel.send_offset < size) {
+                    queue_send(id, channel);
+                    return;
+                }
+            }
+
+            ssize_t outcome = result > 0 ? static_cast<ssize_t>(size) : (result < 0 ? result : -EPIPE);
+            channel.send_buffer.reset();
+            channel.handler->on_send(outcome);
+        }
+
+        /**
+         * @brief The send of a closed channel completed: free its slot
+         */
+        void finish_draining(ChannelId id) {
+            uint32_t index = index_of(id);
+            if (index >= channels_.size()) return;
+            Channel& channel = channels_[index];
+            if (!channel.draining || channel.generation != static_cast<uint32_t>(id >> 32)) {
+                return;
+            }
+            ::close(channel.fd);
+            release(index);
+            --draining_;
+        }
+
+        void complete_recv(ChannelId id, Channel* channel, const io_uring_cqe& cqe) {
+            bool has_buffer = cqe.flags & IORING_CQE_F_BUFFER;
+            uint16_t bid = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+
+            if (channel && !(cqe.flags & IORING_CQE_F_MORE)) {
+                channel->recv_armed = false;
+            }
+
+            if (!channel || !channel->reading || cqe.res == -ECANCELED) {
+                if (has_buffer) recycle(bid);
+                return;
+            }
+
+            if (cqe.res == -ENOBUFS) {
+                // Every buffer was in use; they are back in the ring by now
+                if (!channel->recv_armed) {
+                    arm_recv(id, *channel);
+                }
+                return;
+            }
+
+            if (cqe.res <= 0) {
+                channel->reading = false;
+                channel->handler->on_recv(nullptr, cqe.res);
+                if (has_buffer) recycle(bid);
+                return;
+            }
+
+            channel->handler->on_recv(recv_buffers_ + bid * RECV_BUFFER_SIZE, cqe.res);
+            recycle(bid);
+
+            channel = lookup(id);
+            if (channel && channel->reading && !channel->recv_armed) {
+                arm_recv(id, *channel);
+            }
+        }
+    };
+} // anonymous namespace
+
+std::unique_ptr<IoBackend> make_io_uring_backend() {
+    return std::make_unique<IoUringBackend>();
+}
+
+} // namespace conduit
+
+#else
+
+namespace conduit {
+
+std::unique_ptr<IoBackend> make_io_uring_backend() {
+    throw ConnectionException("io_uring support was not compiled in");
+}
+
+} // namespace conduit
+
+#endif // CONDUIT_HAVE_IO_URING
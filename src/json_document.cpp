@@ -0,0 +1,426 @@
+#include "conduit.hpp"
+#include "json_number.hpp"
+#include "json_scan.hpp"
+#include "json_structural.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace conduit {
+
+static_assert(sizeof(JsonNode) == 16, "JsonNode must stay a 16-byte tagged value");
+static_assert(sizeof(JsonMember) == 2 * sizeof(JsonNode), "members are copied as pairs of nodes");
+
+/**
+ * @brief Monotonic block allocator backing a JsonDocument
+ *
+ * Blocks start near the size of the input and double up to MAX_BLOCK;
+ * nothing is freed until the whole arena is.
+ */
+struct JsonDocument::Arena {
+    static constexpr size_t MIN_BLOCK = 4 * 1024;
+    static constexpr size_t MAX_BLOCK = 16 * 1024 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char* cursor = nullptr;
+    size_t remaining = 0;
+    size_t reserved = 0;
+    size_t last_block = 0;
+    size_t next_block;
+
+    explicit Arena(size_t size_hint) : next_block(std::clamp(size_hint, MIN_BLOCK, MAX_BLOCK)) {}
+
+    void* allocate(size_t bytes, size_t alignment) {
+        size_t padding = (alignment - reinterpret_cast<uintptr_t>(cursor) % alignment) % alignment;
+        if (padding + bytes > remaining) {
+            grow(bytes);
+            padding = 0;
+        }
+        char* result = cursor + padding;
+        cursor = result + bytes;
+        remaining -= padding + bytes;
+        return result;
+    }
+
+    void grow(size_t bytes) {
+        // new char[] is aligned for any fundamental type
+        size_t size = std::max(next_block, bytes);
+        blocks.emplace_back(new char[size]);
+        cursor = blocks.back().get();
+        remaining = size;
+        reserved += size;
+        last_block = size;
+        next_block = std::min(next_block * 2, MAX_BLOCK);
+    }
+
+    /**
+     * @brief Free everything allocated, keeping the newest (largest) block
+     */
+    void reset() {
+        if (blocks.empty()) {
+            return;
+        }
+        blocks.erase(blocks.begin(), blocks.end() - 1);
+        cursor = blocks.back().get();
+        remaining = last_block;
+        reserved = last_block;
+    }
+};
+
+namespace detail {
+    /**
+     * @brief Stage 2: builds nodes into an arena by walking the token index
+     *
+     * Stage 1 (build_structural_index) has already found where every token
+     * starts, so whitespace is never looked at and only the bytes of strings
+     * and scalars are read. Children of the container being parsed collect
+     * on one shared stack and are copied into the arena in a single block
+     * when it closes. Malformed input is reported through return values.
+     */
+    class JsonDocumentParser {
+    public:
+        static constexpr int MAX_DEPTH = 1024;
+
+        JsonDocumentParser(std::string_view input, JsonDocument::Arena& arena, bool in_place)
+            : input_(input), arena_(arena), in_place_(in_place) {}
+
+        /**
+         * @brief Start over on new input, keeping the scratch buffers
+         */
+        void reset(std::string_view input) {
+            input_ = input;
+            index_.clear();
+            stack_.clear();
+            next_ = 0;
+            depth_ = 0;
+        }
+
+        bool parse(const JsonNode*& root) {
+            if (!build_structural_index(input_, index_) || index_.empty()) {
+                return false;
+            }
+            JsonNode value;
+            if (!parse_value(value) || next_ != index_.size()) {
+                return false;
+            }
+            root = new (arena_.allocate(sizeof(JsonNode), alignof(JsonNode))) JsonNode(value);
+            return true;
+        }
+
+    private:
+        std::string_view input_;
+        JsonDocument::Arena& arena_;
+        bool in_place_;         // plain strings point into input_
+        std::vector<uint32_t> index_;
+        size_t next_ = 0;
+        std::vector<JsonNode> stack_;
+        std::string unescaped_;
+        int depth_ = 0;
+
+        static bool is_space(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+        char peek() const { return next_ < index_.size() ? input_[index_[next_]] : '\0'; }
+
+        /**
+         * @brief The token starting at position, which must be the one just
+         *        consumed: everything up to the next token, less whitespace
+         */
+        std::string_view token(size_t position) const {
+            size_t end = next_ < index_.size() ? index_[next_] : input_.size();
+            while (end > position && is_space(input_[end - 1])) {
+                --end;
+            }
+            return input_.substr(position, end - position);
+        }
+
+        bool parse_value(JsonNode& out) {
+            if (next_ == index_.size()) {
+                return false;
+            }
+            size_t position = index_[next_++];
+            switch (input_[position]) {
+                case '{': return parse_object(out);
+                case '[': return parse_array(out);
+                case '"': return parse_string(position, out);
+                case '}': case ']': case ':': case ',': return false;
+                default: return parse_scalar(token(position), out);
+            }
+        }
+
+        bool parse_scalar(std::string_view text, JsonNode& out) {
+            if (text == "true" || text == "false") {
+                out.type_ = JsonType::Boolean;
+                out.boolean_ = text[0] == 't';
+                return true;
+            }
+            if (text == "null") {
+                out.type_ = JsonType::Null;
+                return true;
+            }
+            return parse_number(text, out);
+        }
+
+        bool parse_number(std::string_view text, JsonNode& out) {
+            ParsedNumber number;
+            if (!parse_json_number(text, number)) {
+                return false;
+            }
+            out.type_ = JsonType::Number;
+            if (number.is_integer) {
+                out.integer_ = number.integer;
+                out.size_ = JsonNode::INTEGER;
+            } else {
+                out.number_ = number.value;
+            }
+            return true;
+        }
+
+        const char* store(const char* data, size_t length) {
+            char* copy = static_cast<char*>(arena_.allocate(length, 1));
+            std::memcpy(copy, data, length);
+            return copy;
+        }
+
+        bool parse_string(size_t position, JsonNode& out) {
+            // Stage 1 guarantees the string is closed, and only whitespace
+            // can separate the closing quote from the next token
+            std::string_view quoted = token(position);
+            if (quoted.size() < 2 || quoted.back() != '"') {
+                return false;
+            }
+            std::string_view content = quoted.substr(1, quoted.size() - 2);
+
+            bool plain = true;
+            for (char c : content) {
+                if (c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+                    plain = false;
+                    break;
+                }
+            }
+            if (!plain) {
+                unescaped_.clear();
+                if (!detail::append_unescaped(content, unescaped_)) {
+                    return false;
+                }
+                content = unescaped_;
+            }
+
+            if (content.size() > std::numeric_limits<uint32_t>::max()) {
+                return false;
+            }
+            out.type_ = JsonType::String;
+            out.string_ = plain && in_place_ ? content.data() : store(content.data(), content.size());
+            out.size_ = static_cast<uint32_t>(content.size());
+            return true;
+        }
+
+        template<typename T>
+        const T* flush_children(size_t base) {
+            size_t count = stack_.size() - base;
+            if (count == 0) {
+                return nullptr;
+            }
+            void* block = arena_.allocate(count * sizeof(JsonNode), alignof(JsonNode));
+            std::memcpy(block, stack_.data() + base, count * sizeof(JsonNode));
+            stack_.resize(base);
+            return static_cast<const T*>(block);
+        }
+
+        bool parse_array(JsonNode& out) {
+            if (++depth_ > MAX_DEPTH) return false;
+            size_t base = stack_.size();
+
+            if (peek() == ']') {
+                ++next_;
+            } else {
+                while (true) {
+                    JsonNode element;
+                    if (!parse_value(element)) return false;
+                    stack_.push_back(element);
+
+                    char separator = peek();
+                    ++next_;
+                    if (separator == ']') break;
+                    if (separator != ',') return false;
+                }
+            }
+
+            size_t count = stack_.size() - base;
+            if (count > std::numeric_limits<uint32_t>::max()) return false;
+            out.type_ = JsonType::Array;
+            out.size_ = static_cast<uint32_t>(count);
+            out.elements_ = flush_children<JsonNode>(base);
+            --depth_;
+            return true;
+        }
+
+        bool parse_object(JsonNode& out) {
+            if (++depth_ > MAX_DEPTH) return false;
+            size_t base = stack_.size();
+
+            if (peek() == '}') {
+                ++next_;
+            } else {
+                while (true) {
+                    if (peek() != '"') return false;
+                    JsonNode key;
+                    if (!parse_string(index_[next_++], key)) return false;
+                    stack_.push_back(key);
+
+                    if (peek() != ':') return false;
+                    ++next_;
+
+                    JsonNode value;
+                    if (!parse_value(value)) return false;
+                    stack_.push_back(value);
+
+                    char separator = peek();
+                    ++next_;
+                    if (separator == '}') break;
+                    if (separator != ',') return false;
+                }
+            }
+
+            size_t count = (stack_.size() - base) / 2;
+            if (count > std::numeric_limits<uint32_t>::max()) return false;
+            out.type_ = JsonType::Object;
+            out.size_ = static_cast<uint32_t>(count);
+            out.members_ = flush_children<JsonMember>(base);
+            --depth_;
+            return true;
+        }
+    };
+} // namespace detail
+
+// JsonNode implementation
+const JsonNode* JsonNode::find(std::string_view key) const {
+    auto members = this->members();
+    for (size_t i = members.size(); i-- > 0;) {
+        if (members[i].key.as_string() == key) {
+            return &members[i].value;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<int> JsonNode::get_int(std::string_view key) const {
+    auto value = get_int64(key);
+    return value ? std::optional<int>(static_cast<int>(*value)) : std::nullopt;
+}
+
+std::optional<int64_t> JsonNode::get_int64(std::string_view key) const {
+    // Doubles past the int64_t range have no integer value
+    const JsonNode* value = find(key);
+    if (value && (value->is_integer() || (value->is_number() && detail::fits_int64(value->as_number())))) {
+        return value->as_int64();
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> JsonNode::get_string(std::string_view key) const {
+    const JsonNode* value = find(key);
+    if (value && value->is_string()) {
+        return std::string(value->as_string());
+    }
+    return std::nullopt;
+}
+
+std::optional<bool> JsonNode::get_bool(std::string_view key) const {
+    const JsonNode* value = find(key);
+    if (value && value->is_bool()) {
+        return value->boolean_;
+    }
+    return std::nullopt;
+}
+
+std::optional<double> JsonNode::get_number(std::string_view key) const {
+    const JsonNode* value = find(key);
+    if (value && value->is_number()) {
+        return value->as_number();
+    }
+    return std::nullopt;
+}
+
+JsonValue JsonNode::to_value() const {
+    switch (type_) {
+        case JsonType::Boolean:
+            return JsonValue(boolean_);
+        case JsonType::Number:
+            return is_integer() ? JsonValue(integer_) : JsonValue(number_);
+        case JsonType::String:
+            return JsonValue(std::string(as_string()));
+        case JsonType::Array: {
+            auto array = std::make_shared<std::vector<std::shared_ptr<JsonValue>>>();
+            array->reserve(size_);
+            for (const auto& element : elements()) {
+                array->push_back(std::make_shared<JsonValue>(element.to_value()));
+            }
+            JsonValue result;
+            result.set_array(array);
+            return result;
+        }
+        case JsonType::Object: {
+            // A repeated key keeps its first position and its last value
+            auto object = std::make_shared<JsonObject>();
+            object->reserve(size_);
+            for (const auto& member : members()) {
+                object->insert_or_assign(member.key.as_string(), std::make_shared<JsonValue>(member.value.to_value()));
+            }
+            JsonValue result;
+            result.set_object(object);
+            return result;
+        }
+        default:
+            return JsonValue();
+    }
+}
+
+// JsonDocument implementation
+JsonDocument::JsonDocument() = default;
+JsonDocument::JsonDocument(JsonDocument&&) noexcept = default;
+JsonDocument& JsonDocument::operator=(JsonDocument&&) noexcept = default;
+JsonDocument::~JsonDocument() = default;
+
+std::optional<JsonDocument> JsonDocument::parse(std::string_view json) {
+    return parse(json, false);
+}
+
+std::optional<JsonDocument> JsonDocument::parse_in_place(std::string_view json) {
+    return parse(json, true);
+}
+
+bool JsonDocument::reparse_in_place(std::string_view json) {
+    static const JsonNode null_node;
+
+    if (!arena_) {
+        arena_ = std::make_unique<Arena>(json.size());
+    }
+    arena_->reset();
+    if (parser_) {
+        parser_->reset(json);
+    } else {
+        parser_ = std::make_unique<detail::JsonDocumentParser>(json, *arena_, true);
+    }
+    if (!parser_->parse(root_)) {
+        root_ = &null_node;
+        return false;
+    }
+    return true;
+}
+
+std::optional<JsonDocument> JsonDocument::parse(std::string_view json, bool in_place) {
+    JsonDocument document;
+    document.arena_ = std::make_unique<Arena>(json.size());
+    detail::JsonDocumentParser parser(json, *document.arena_, in_place);
+    if (!parser.parse(document.root_)) {
+        return std::nullopt;
+    }
+    return document;
+}
+
+size_t JsonDocument::memory_usage() const {
+    return arena_ ? arena_->reserved : 0;
+}
+
+} // namespace conduit
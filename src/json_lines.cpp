@@ -0,0 +1,72 @@
+#include "conduit.hpp"
+#include "json_scan.hpp"
+#include <cstring>
+
+namespace conduit {
+
+bool JsonLinesParser::feed(const char* data, size_t size) {
+    size_t i = 0;
+    while (i < size && state_ == State::Running) {
+        const void* hit = std::memchr(data + i, '\n', size - i);
+        size_t end = hit ? static_cast<size_t>(static_cast<const char*>(hit) - data) : size;
+
+        if (partial_.size() + (end - i) > max_line_bytes_) {
+            state_ = State::Failed;
+            break;
+        }
+        if (!hit) {
+            partial_.append(data + i, end - i);
+            break;
+        }
+
+        // A line wholly inside this chunk is parsed where it lies
+        if (partial_.empty()) {
+            deliver(std::string_view(data + i, end - i));
+        } else {
+            partial_.append(data + i, end - i);
+            deliver(partial_);
+            partial_.clear();
+        }
+        if (state_ == State::Running) {
+            ++line_number_;
+        }
+        i = end + 1;
+    }
+    return state_ == State::Running;
+}
+
+bool JsonLinesParser::finish() {
+    if (state_ == State::Running && !partial_.empty()) {
+        deliver(partial_);
+        partial_.clear();
+    }
+    return state_ != State::Failed;
+}
+
+void JsonLinesParser::reset() {
+    state_ = State::Running;
+    partial_.clear();
+    records_ = 0;
+    line_number_ = 1;
+}
+
+bool JsonLinesParser::deliver(std::string_view line) {
+    if (detail::skip_space(line, 0) == line.size()) {
+        return true;
+    }
+
+    bool parsed = document_ ? document_->reparse_in_place(line)
+                            : (document_ = JsonDocument::parse_in_place(line)).has_value();
+    if (!parsed) {
+        state_ = State::Failed;
+        return false;
+    }
+    ++records_;
+    if (!handler_(document_->root())) {
+        state_ = State::Stopped;
+        return false;
+    }
+    return true;
+}
+
+} // namespace conduit
@@ -0,0 +1,107 @@
+#include "json_number.hpp"
+#include <charconv>
+#include <cmath>
+#include <limits>
+
+namespace conduit {
+namespace detail {
+
+namespace {
+    bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+    /**
+     * @brief Check the JSON number grammar; reports whether text is integral
+     */
+    bool valid_number(std::string_view text, bool& integral) {
+        size_t i = 0;
+        auto digits = [&] {
+            size_t first = i;
+            while (i < text.size() && is_digit(text[i])) ++i;
+            return i > first;
+        };
+
+        if (i < text.size() && text[i] == '-') ++i;
+        if (i < text.size() && text[i] == '0') {
+            ++i;
+        } else if (!digits()) {
+            return false;
+        }
+        integral = true;
+        if (i < text.size() && text[i] == '.') {
+            ++i;
+            integral = false;
+            if (!digits()) return false;
+        }
+        if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+            ++i;
+            integral = false;
+            if (i < text.size() && (text[i] == '+' || text[i] == '-')) ++i;
+            if (!digits()) return false;
+        }
+        return i == text.size();
+    }
+} // anonymous namespace
+
+bool parse_json_number(std::string_view text, ParsedNumber& number) {
+    bool integral = false;
+    if (!valid_number(text, integral)) {
+        return false;
+    }
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+
+    // -0 stays a double so its sign survives a round trip
+    if (integral && text != "-0") {
+        int64_t integer;
+        auto result = std::from_chars(first, last, integer);
+        if (result.ec == std::errc() && result.ptr == last) {
+            number.integer = integer;
+            number.value = static_cast<double>(integer);
+            number.is_integer = true;
+            return true;
+        }
+    }
+
+    double value;
+    auto result = std::from_chars(first, last, value);
+    if (result.ec == std::errc::result_out_of_range) {
+        // Too large becomes infinity and too small becomes zero, as strtod does
+        bool negative = text[0] == '-';
+        size_t exponent = text.find_first_of("eE");
+        bool tiny = exponent != std::string_view::npos && exponent + 1 < text.size() && text[exponent + 1] == '-';
+        value = tiny ? 0.0 : std::numeric_limits<double>::infinity();
+        value = negative ? -value : value;
+    } else if (result.ec != std::errc() || result.ptr != last) {
+        return false;
+    }
+    number.value = value;
+    number.integer = 0;
+    number.is_integer = false;
+    return true;
+}
+
+void append_json_number(std::string& out, double value) {
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    // Shortest representation that round-trips; 32 bytes covers any double
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+void append_json_number(std::string& out, int64_t value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+void append_json_number(std::string& out, uint64_t value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+} // namespace detail
+} // namespace conduit
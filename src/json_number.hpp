@@ -0,0 +1,44 @@
+#ifndef CONDUIT_JSON_NUMBER_HPP
+#define CONDUIT_JSON_NUMBER_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace conduit {
+namespace detail {
+
+/**
+ * @brief A JSON number as both a double and, when exact, an integer
+ */
+struct ParsedNumber {
+    double value = 0.0;
+    int64_t integer = 0;
+    bool is_integer = false;    // no fraction or exponent, and fits int64_t
+};
+
+/**
+ * @brief Convert text that must be exactly one JSON number
+ *
+ * Shared by every JSON parser in the library so they all accept the same
+ * grammar: no leading '+' or zeros, no bare '.', hex, inf or nan. Uses
+ * std::from_chars, so the result is correctly rounded, independent of the
+ * locale, and allocation-free.
+ *
+ * @return false, leaving number untouched, if text is not a JSON number
+ */
+bool parse_json_number(std::string_view text, ParsedNumber& number);
+
+/**
+ * @brief Append the shortest text that parses back to exactly value
+ *
+ * Non-finite values, which JSON cannot represent, are written as null.
+ */
+void append_json_number(std::string& out, double value);
+void append_json_number(std::string& out, int64_t value);
+void append_json_number(std::string& out, uint64_t value);
+
+} // namespace detail
+} // namespace conduit
+
+#endif // CONDUIT_JSON_NUMBER_HPP
@@ -0,0 +1,202 @@
+#include "conduit.hpp"
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace conduit {
+
+namespace {
+    /**
+     * @brief Process-wide key names; entries are never freed
+     */
+    struct KeyPool {
+        std::mutex mutex;
+        std::deque<std::string> storage;            // stable addresses
+        std::unordered_set<std::string_view> names;
+    };
+
+    KeyPool& key_pool() {
+        // Leaked on purpose: keys may be used from static destructors
+        static KeyPool* pool = new KeyPool();
+        return *pool;
+    }
+
+    /**
+     * @brief Pooled copy of name, or a view with no data if it is not pooled
+     *
+     * Each thread remembers recent names in a small direct-mapped cache, so
+     * the names a response repeats are found without taking the lock.
+     */
+    std::string_view intern(std::string_view name, uint64_t hash) {
+        if (name.size() > JsonKey::MAX_INTERNED_LENGTH) {
+            return std::string_view();
+        }
+
+        constexpr size_t CACHE_SLOTS = 256;
+        thread_local std::string_view cache[CACHE_SLOTS];
+        std::string_view& cached = cache[(hash ^ hash >> 32) & (CACHE_SLOTS - 1)];
+        if (cached.data() && cached == name) {
+            return cached;
+        }
+
+        KeyPool& pool = key_pool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        auto it = pool.names.find(name);
+        if (it == pool.names.end()) {
+            if (pool.names.size() >= JsonKey::MAX_INTERNED) {
+                return std::string_view();
+            }
+            pool.storage.emplace_back(name);
+            it = pool.names.insert(pool.storage.back()).first;
+        }
+        cached = *it;
+        return cached;
+    }
+
+    size_t slot_of(uint64_t hash, size_t mask) {
+        return static_cast<size_t>(hash ^ hash >> 32) & mask;
+    }
+} // anonymous namespace
+
+JsonKey::JsonKey(std::string_view name) : hash_(detail::json_key_hash(name)) {
+    text_ = intern(name, hash_);
+    if (!text_.data()) {
+        owned_ = std::make_shared<const std::string>(name);
+        text_ = *owned_;
+    }
+}
+
+JsonObject::JsonObject(const std::map<std::string, mapped_type>& members) {
+    members_.reserve(members.size());
+    for (const auto& [name, value] : members) {
+        append(JsonKey(name), mapped_type(value));
+    }
+}
+
+void JsonObject::clear() {
+    members_.clear();
+    index_.clear();
+}
+
+JsonObject::iterator JsonObject::find(std::string_view name) {
+    return members_.begin() + static_cast<std::ptrdiff_t>(locate(name, detail::json_key_hash(name)));
+}
+
+JsonObject::const_iterator JsonObject::find(std::string_view name) const {
+    return members_.begin() + static_cast<std::ptrdiff_t>(locate(name, detail::json_key_hash(name)));
+}
+
+JsonObject::mapped_type& JsonObject::at(std::string_view name) {
+    auto it = find(name);
+    if (it == end()) {
+        throw std::out_of_range("JsonObject::at: no member named " + std::string(name));
+    }
+    return it->second;
+}
+
+const JsonObject::mapped_type& JsonObject::at(std::string_view name) const {
+    auto it = find(name);
+    if (it == end()) {
+        throw std::out_of_range("JsonObject::at: no member named " + std::string(name));
+    }
+    return it->second;
+}
+
+JsonObject::mapped_type& JsonObject::operator[](std::string_view name) {
+    auto it = find(name);
+    if (it == end()) {
+        it = append(JsonKey(name), nullptr);
+    }
+    return it->second;
+}
+
+std::pair<JsonObject::iterator, bool> JsonObject::emplace(JsonKey name, mapped_type value) {
+    size_t position = locate(name.view(), name.hash());
+    if (position != members_.size()) {
+        return {members_.begin() + static_cast<std::ptrdiff_t>(position), false};
+    }
+    return {append(std::move(name), std::move(value)), true};
+}
+
+std::pair<JsonObject::iterator, bool> JsonObject::insert_or_assign(JsonKey name, mapped_type value) {
+    size_t position = locate(name.view(), name.hash());
+    if (position != members_.size()) {
+        members_[position].second = std::move(value);
+        return {members_.begin() + static_cast<std::ptrdiff_t>(position), false};
+    }
+    return {append(std::move(name), std::move(value)), true};
+}
+
+size_t JsonObject::erase(std::string_view name) {
+    size_t position = locate(name, detail::json_key_hash(name));
+    if (position == members_.size()) {
+        return 0;
+    }
+    members_.erase(members_.begin() + static_cast<std::ptrdiff_t>(position));
+    rebuild_index();
+    return 1;
+}
+
+/**
+ * @brief Position of the member with this name, or size() if there is none
+ */
+size_t JsonObject::locate(std::string_view name, uint64_t hash) const {
+    if (index_.empty()) {
+        for (size_t i = 0; i < members_.size(); ++i) {
+            if (members_[i].first.equals(name, hash)) {
+                return i;
+            }
+        }
+        return members_.size();
+    }
+
+    size_t mask = index_.size() - 1;
+    for (size_t slot = slot_of(hash, mask); index_[slot] != 0; slot = (slot + 1) & mask) {
+        size_t position = index_[slot] - 1;
+        if (members_[position].first.equals(name, hash)) {
+            return position;
+        }
+    }
+    return members_.size();
+}
+
+JsonObject::iterator JsonObject::append(JsonKey&& name, mapped_type&& value) {
+    members_.emplace_back(std::move(name), std::move(value));
+    if (members_.size() > INDEX_THRESHOLD) {
+        // Kept at most a quarter full so probes stay short
+        if (index_.size() < members_.size() * 4) {
+            rebuild_index();
+        } else {
+            index_member(members_.size() - 1);
+        }
+    }
+    return members_.end() - 1;
+}
+
+void JsonObject::index_member(size_t position) {
+    size_t mask = index_.size() - 1;
+    size_t slot = slot_of(members_[position].first.hash(), mask);
+    while (index_[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    index_[slot] = static_cast<uint32_t>(position + 1);
+}
+
+void JsonObject::rebuild_index() {
+    index_.clear();
+    if (members_.size() <= INDEX_THRESHOLD) {
+        index_.shrink_to_fit();
+        return;
+    }
+    size_t slots = 64;
+    while (slots < members_.size() * 8) {
+        slots *= 2;
+    }
+    index_.assign(slots, 0);
+    for (size_t i = 0; i < members_.size(); ++i) {
+        index_member(i);
+    }
+}
+
+} // namespace conduit
@@ -0,0 +1,220 @@
+#include "conduit.hpp"
+#include "json_number.hpp"
+#include "json_scan.hpp"
+#include <charconv>
+#include <cmath>
+
+namespace conduit {
+
+using detail::skip_space;
+using detail::skip_string;
+using detail::skip_value;
+
+namespace {
+    constexpr size_t npos = std::string_view::npos;
+
+    /**
+     * @brief Contents of a quoted token, decoded into scratch only if needed
+     */
+    bool string_contents(std::string_view quoted, std::string& scratch, std::string_view& out) {
+        std::string_view content = quoted.substr(1, quoted.size() - 2);
+        for (char c : content) {
+            if (c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+                if (!detail::decode_json_string(quoted, scratch)) {
+                    return false;
+                }
+                out = scratch;
+                return true;
+            }
+        }
+        out = content;
+        return true;
+    }
+} // anonymous namespace
+
+bool JsonReader::finish() {
+    return !failed_ && skip_space(text_, pos_) == text_.size();
+}
+
+bool JsonReader::read_null() {
+    size_t i = skip_space(text_, pos_);
+    if (failed_ || text_.compare(i, 4, "null") != 0) {
+        return false;
+    }
+    pos_ = i + 4;
+    return true;
+}
+
+bool JsonReader::read(bool& value) {
+    std::string_view text = scalar();
+    if (text == "true" || text == "false") {
+        value = text[0] == 't';
+        return true;
+    }
+    return fail();
+}
+
+bool JsonReader::read(int64_t& value) {
+    detail::ParsedNumber number;
+    if (!detail::parse_json_number(scalar(), number)) {
+        return fail();
+    }
+    if (number.is_integer) {
+        value = number.integer;
+        return true;
+    }
+    // 1e3 or 2.0 still name an integer; 0.5 or 1e30 do not
+    if (number.value != std::trunc(number.value) ||
+        number.value < -9223372036854775808.0 || number.value >= 9223372036854775808.0) {
+        return fail();
+    }
+    value = static_cast<int64_t>(number.value);
+    return true;
+}
+
+bool JsonReader::read(uint64_t& value) {
+    std::string_view text = scalar();
+    detail::ParsedNumber number;
+    if (!detail::parse_json_number(text, number)) {
+        return fail();
+    }
+    if (number.is_integer) {
+        if (number.integer < 0) {
+            return fail();
+        }
+        value = static_cast<uint64_t>(number.integer);
+        return true;
+    }
+    // Digits past INT64_MAX are still exact; the double is not
+    const char* last = text.data() + text.size();
+    auto result = std::from_chars(text.data(), last, value);
+    if (result.ec == std::errc() && result.ptr == last) {
+        return true;
+    }
+    if (number.value != std::trunc(number.value) || number.value < 0.0 ||
+        number.value >= 18446744073709551616.0) {
+        return fail();
+    }
+    value = static_cast<uint64_t>(number.value);
+    return true;
+}
+
+bool JsonReader::read(double& value) {
+    detail::ParsedNumber number;
+    if (!detail::parse_json_number(scalar(), number)) {
+        return fail();
+    }
+    value = number.value;
+    return true;
+}
+
+bool JsonReader::read(std::string& value) {
+    size_t start = skip_space(text_, pos_);
+    if (failed_ || start == text_.size() || text_[start] != '"') {
+        return fail();
+    }
+    size_t end = skip_string(text_, start);
+    std::string_view content;
+    if (end == npos || !string_contents(text_.substr(start, end - start), scratch_, content)) {
+        return fail();
+    }
+    value.assign(content.data(), content.size());
+    pos_ = end;
+    return true;
+}
+
+bool JsonReader::begin_object() {
+    if (!expect('{')) {
+        return false;
+    }
+    first_ = true;
+    return true;
+}
+
+bool JsonReader::next_key(std::string_view& key) {
+    pos_ = skip_space(text_, pos_);
+    if (failed_ || pos_ == text_.size()) {
+        return fail();
+    }
+    if (text_[pos_] == '}') {
+        ++pos_;
+        first_ = false;
+        return false;
+    }
+    if (!first_ && !expect(',')) {
+        return false;
+    }
+
+    size_t start = skip_space(text_, pos_);
+    if (start == text_.size() || text_[start] != '"') {
+        return fail();
+    }
+    size_t end = skip_string(text_, start);
+    if (end == npos || !string_contents(text_.substr(start, end - start), scratch_, key)) {
+        return fail();
+    }
+    pos_ = end;
+    first_ = false;
+    return expect(':');
+}
+
+bool JsonReader::begin_array() {
+    if (!expect('[')) {
+        return false;
+    }
+    first_ = true;
+    return true;
+}
+
+bool JsonReader::next_element() {
+    pos_ = skip_space(text_, pos_);
+    if (failed_ || pos_ == text_.size()) {
+        return fail();
+    }
+    if (text_[pos_] == ']') {
+        ++pos_;
+        first_ = false;
+        return false;
+    }
+    if (!first_ && !expect(',')) {
+        return false;
+    }
+    first_ = false;
+    return true;
+}
+
+bool JsonReader::skip() {
+    size_t start = skip_space(text_, pos_);
+    size_t end = skip_value(text_, start);
+    if (failed_ || end == npos || end == start) {
+        return fail();
+    }
+    pos_ = end;
+    first_ = false;
+    return true;
+}
+
+bool JsonReader::expect(char c) {
+    pos_ = skip_space(text_, pos_);
+    if (failed_ || pos_ == text_.size() || text_[pos_] != c) {
+        return fail();
+    }
+    ++pos_;
+    return true;
+}
+
+/**
+ * @brief Next number or literal token; empty if a string or container is next
+ */
+std::string_view JsonReader::scalar() {
+    size_t start = skip_space(text_, pos_);
+    if (failed_ || start == text_.size() || text_[start] == '"' ||
+        text_[start] == '{' || text_[start] == '[') {
+        return std::string_view();
+    }
+    size_t end = skip_value(text_, start);
+    pos_ = end;
+    return text_.substr(start, end - start);
+}
+
+} // namespace conduit
@@ -0,0 +1,204 @@
+#ifndef CONDUIT_JSON_SCAN_HPP
+#define CONDUIT_JSON_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace conduit {
+namespace detail {
+
+// Helpers shared by the JSON readers. The skip_* functions are
+// non-validating and serve JsonView and JsonReader, which walk text in
+// place: offsets index into text, and npos means the value runs past the
+// end. The escape decoder is shared with the document parser.
+
+inline bool is_space(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+inline size_t skip_space(std::string_view text, size_t i) {
+    while (i < text.size() && is_space(text[i])) ++i;
+    return i;
+}
+
+/**
+ * @brief Offset just past the string opening at i, or std::string_view::npos
+ */
+inline size_t skip_string(std::string_view text, size_t i) {
+    ++i;
+    while (i < text.size()) {
+        const void* hit = std::memchr(text.data() + i, '"', text.size() - i);
+        if (!hit) {
+            return std::string_view::npos;
+        }
+        size_t quote = static_cast<size_t>(static_cast<const char*>(hit) - text.data());
+
+        // The quote is escaped if an odd run of backslashes precedes it
+        size_t backslashes = 0;
+        while (quote - backslashes > i && text[quote - backslashes - 1] == '\\') ++backslashes;
+        if (backslashes % 2 == 0) {
+            return quote + 1;
+        }
+        i = quote + 1;
+    }
+    return std::string_view::npos;
+}
+
+/**
+ * @brief Offset just past the value starting at i, or std::string_view::npos
+ *
+ * Containers are stepped over by counting brackets outside strings;
+ * their contents are not checked.
+ */
+inline size_t skip_value(std::string_view text, size_t i) {
+    if (i >= text.size()) {
+        return std::string_view::npos;
+    }
+    char first = text[i];
+    if (first == '"') {
+        return skip_string(text, i);
+    }
+    if (first != '{' && first != '[') {
+        while (i < text.size() && !is_space(text[i]) &&
+               text[i] != ',' && text[i] != '}' && text[i] != ']') {
+            ++i;
+        }
+        return i;
+    }
+
+    size_t depth = 0;
+    while (i < text.size()) {
+        switch (text[i]) {
+            case '"':
+                i = skip_string(text, i);
+                if (i == std::string_view::npos) return std::string_view::npos;
+                continue;
+            case '{':
+            case '[':
+                ++depth;
+                break;
+            case '}':
+            case ']':
+                if (--depth == 0) return i + 1;
+                break;
+            default:
+                break;
+        }
+        ++i;
+    }
+    return std::string_view::npos;
+}
+
+inline int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+inline bool read_hex4(std::string_view text, size_t& i, uint32_t& value) {
+    if (text.size() - i < 4) return false;
+    value = 0;
+    for (int n = 0; n < 4; ++n) {
+        int digit = hex_value(text[i++]);
+        if (digit < 0) return false;
+        value = value << 4 | static_cast<uint32_t>(digit);
+    }
+    return true;
+}
+
+inline void append_utf8(uint32_t code_point, std::string& out) {
+    if (code_point < 0x80) {
+        out += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        out += static_cast<char>(0xc0 | code_point >> 6);
+        out += static_cast<char>(0x80 | (code_point & 0x3f));
+    } else if (code_point < 0x10000) {
+        out += static_cast<char>(0xe0 | code_point >> 12);
+        out += static_cast<char>(0x80 | (code_point >> 6 & 0x3f));
+        out += static_cast<char>(0x80 | (code_point & 0x3f));
+    } else {
+        out += static_cast<char>(0xf0 | code_point >> 18);
+        out += static_cast<char>(0x80 | (code_point >> 12 & 0x3f));
+        out += static_cast<char>(0x80 | (code_point >> 6 & 0x3f));
+        out += static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+}
+
+/**
+ * @brief Append string contents (without the quotes) to out, decoding escapes
+ *
+ * Unpaired surrogates become U+FFFD; raw control characters and unknown
+ * escapes are errors, after which out holds a partial result.
+ */
+inline bool append_unescaped(std::string_view content, std::string& out) {
+    size_t i = 0;
+    while (i < content.size()) {
+        // Copy the run up to the next escape or control character in one go
+        size_t run = i;
+        while (run < content.size() && content[run] != '\\' &&
+               static_cast<unsigned char>(content[run]) >= 0x20) {
+            ++run;
+        }
+        out.append(content.data() + i, run - i);
+        if (run == content.size()) {
+            break;
+        }
+        i = run;
+
+        char c = content[i++];
+        if (c != '\\' || i == content.size()) {
+            return false;
+        }
+        switch (content[i++]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                uint32_t code_point;
+                if (!read_hex4(content, i, code_point)) return false;
+                if (code_point >= 0xd800 && code_point < 0xdc00 &&
+                    content.size() - i >= 6 && content[i] == '\\' && content[i + 1] == 'u') {
+                    size_t after = i + 2;
+                    uint32_t low;
+                    if (!read_hex4(content, after, low)) return false;
+                    if (low >= 0xdc00 && low < 0xe000) {
+                        code_point = 0x10000 + ((code_point - 0xd800) << 10) + (low - 0xdc00);
+                        i = after;
+                    }
+                }
+                if (code_point >= 0xd800 && code_point < 0xe000) {
+                    code_point = 0xfffd;
+                }
+                append_utf8(code_point, out);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Decode a complete quoted string token, escapes included, into out
+ * @return false if the token is not a valid JSON string
+ */
+inline bool decode_json_string(std::string_view quoted, std::string& out) {
+    out.clear();
+    if (quoted.size() < 2 || quoted.front() != '"' || quoted.back() != '"') {
+        return false;
+    }
+    return append_unescaped(quoted.substr(1, quoted.size() - 2), out);
+}
+
+} // namespace detail
+} // namespace conduit
+
+#endif // CONDUIT_JSON_SCAN_HPP
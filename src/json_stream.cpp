@@ -0,0 +1,366 @@
+#include "conduit.hpp"
+#include "json_number.hpp"
+
+namespace conduit {
+
+namespace {
+    bool is_space(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+    bool is_number_byte(char c) {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+    }
+
+    int hex_value(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+} // anonymous namespace
+
+bool JsonStreamParser::feed(const char* data, size_t size) {
+    size_t i = 0;
+    while (i < size && state_ != State::Error) {
+        switch (state_) {
+            case State::String:
+                i = scan_string(data, size, i);
+                break;
+            case State::Number:
+                i = scan_number(data, size, i);
+                break;
+            case State::Escape:
+                if (escape(data[i])) ++i;
+                break;
+            case State::Unicode:
+                if (unicode_digit(data[i])) ++i;
+                break;
+            case State::Literal:
+                if (data[i] != literal_[literal_matched_]) {
+                    state_ = State::Error;
+                    break;
+                }
+                ++i;
+                if (literal_[++literal_matched_] == '\0') {
+                    value_done();
+                    switch (literal_[0]) {
+                        case 't': handler_->boolean(true); break;
+                        case 'f': handler_->boolean(false); break;
+                        default: handler_->null(); break;
+                    }
+                }
+                break;
+            default:
+                if (structural(data[i])) ++i;
+                break;
+        }
+    }
+    offset_ += i;
+    return state_ != State::Error;
+}
+
+bool JsonStreamParser::finish() {
+    if (state_ == State::Number) {
+        end_number();
+    }
+    if (state_ != State::Done) {
+        state_ = State::Error;
+        return false;
+    }
+    return true;
+}
+
+void JsonStreamParser::reset() {
+    state_ = State::Value;
+    stack_.clear();
+    token_.clear();
+    literal_ = nullptr;
+    literal_matched_ = 0;
+    high_surrogate_ = 0;
+    offset_ = 0;
+}
+
+/**
+ * @brief Handle one byte between tokens; false (and Error) if it is invalid
+ */
+bool JsonStreamParser::structural(char c) {
+    if (is_space(c)) {
+        return true;
+    }
+
+    switch (state_) {
+        case State::Value:
+            return start_value(c);
+
+        case State::ArrayOpen:
+            if (c == ']') {
+                stack_.pop_back();
+                value_done();
+                handler_->end_array();
+                return true;
+            }
+            return start_value(c);
+
+        case State::ObjectOpen:
+        case State::Key:
+            if (c == '"') {
+                in_key_ = true;
+                state_ = State::String;
+                return true;
+            }
+            if (c == '}' && state_ == State::ObjectOpen) {
+                stack_.pop_back();
+                value_done();
+                handler_->end_object();
+                return true;
+            }
+            break;
+
+        case State::Colon:
+            if (c == ':') {
+                state_ = State::Value;
+                return true;
+            }
+            break;
+
+        case State::AfterValue:
+            if (c == ',') {
+                state_ = stack_.back() == '{' ? State::Key : State::Value;
+                return true;
+            }
+            if ((c == '}' || c == ']') && stack_.back() == (c == '}' ? '{' : '[')) {
+                stack_.pop_back();
+                value_done();
+                if (c == '}') {
+                    handler_->end_object();
+                } else {
+                    handler_->end_array();
+                }
+                return true;
+            }
+            break;
+
+        default:
+            break;
+    }
+    state_ = State::Error;
+    return false;
+}
+
+bool JsonStreamParser::start_value(char c) {
+    literal_ = nullptr;
+    switch (c) {
+        case '{':
+        case '[':
+            if (stack_.size() == MAX_DEPTH) {
+                break;
+            }
+            stack_ += c;
+            if (c == '{') {
+                state_ = State::ObjectOpen;
+                handler_->start_object();
+            } else {
+                state_ = State::ArrayOpen;
+                handler_->start_array();
+            }
+            return true;
+        case '"':
+            in_key_ = false;
+            state_ = State::String;
+            return true;
+        case 't':
+            literal_ = "true";
+            break;
+        case 'f':
+            literal_ = "false";
+            break;
+        case 'n':
+            literal_ = "null";
+            break;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                token_.assign(1, c);
+                state_ = State::Number;
+                return true;
+            }
+            break;
+    }
+    if (literal_ && c == literal_[0]) {
+        literal_matched_ = 1;
+        state_ = State::Literal;
+        return true;
+    }
+    state_ = State::Error;
+    return false;
+}
+
+/**
+ * @brief Consume string bytes from i; returns where scanning stopped
+ */
+size_t JsonStreamParser::scan_string(const char* data, size_t size, size_t i) {
+    size_t start = i;
+    while (i < size) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (c == '"' || c == '\\' || c < 0x20) {
+            break;
+        }
+        ++i;
+    }
+
+    if (i > start || (i < size && data[i] == '"')) {
+        flush_surrogate();
+    }
+    if (i == size || data[i] != '"' || !token_.empty()) {
+        token_.append(data + start, i - start);
+        if (token_.size() > MAX_TOKEN_BYTES) {
+            state_ = State::Error;
+            return i;
+        }
+    }
+    if (i == size) {
+        return i;
+    }
+
+    switch (data[i]) {
+        case '"': {
+            // Nothing carried over means the whole string is in this chunk
+            std::string_view value = token_.empty() ? std::string_view(data + start, i - start)
+                                                    : std::string_view(token_);
+            if (in_key_) {
+                state_ = State::Colon;
+                handler_->key(value);
+            } else {
+                value_done();
+                handler_->string(value);
+            }
+            token_.clear();
+            return i + 1;
+        }
+        case '\\':
+            state_ = State::Escape;
+            return i + 1;
+        default:
+            // Raw control characters are not allowed in strings
+            state_ = State::Error;
+            return i;
+    }
+}
+
+bool JsonStreamParser::escape(char c) {
+    if (c == 'u') {
+        code_unit_ = 0;
+        hex_digits_ = 0;
+        state_ = State::Unicode;
+        return true;
+    }
+
+    flush_surrogate();
+    switch (c) {
+        case '"': token_ += '"'; break;
+        case '\\': token_ += '\\'; break;
+        case '/': token_ += '/'; break;
+        case 'b': token_ += '\b'; break;
+        case 'f': token_ += '\f'; break;
+        case 'n': token_ += '\n'; break;
+        case 'r': token_ += '\r'; break;
+        case 't': token_ += '\t'; break;
+        default:
+            state_ = State::Error;
+            return false;
+    }
+    state_ = State::String;
+    return true;
+}
+
+/**
+ * @brief Accumulate one hex digit of \\uXXXX, pairing surrogates
+ *
+ * A high surrogate is held back until the next escape shows whether a low
+ * one follows; unpaired halves become U+FFFD.
+ */
+bool JsonStreamParser::unicode_digit(char c) {
+    int digit = hex_value(c);
+    if (digit < 0) {
+        state_ = State::Error;
+        return false;
+    }
+    code_unit_ = code_unit_ << 4 | static_cast<uint32_t>(digit);
+    if (++hex_digits_ < 4) {
+        return true;
+    }
+
+    state_ = State::String;
+    if (high_surrogate_ && code_unit_ >= 0xdc00 && code_unit_ < 0xe000) {
+        append_utf8(0x10000 + ((high_surrogate_ - 0xd800) << 10) + (code_unit_ - 0xdc00));
+        high_surrogate_ = 0;
+        return true;
+    }
+    flush_surrogate();
+    if (code_unit_ >= 0xd800 && code_unit_ < 0xdc00) {
+        high_surrogate_ = code_unit_;
+    } else {
+        append_utf8(code_unit_ >= 0xdc00 && code_unit_ < 0xe000 ? 0xfffd : code_unit_);
+    }
+    return true;
+}
+
+void JsonStreamParser::flush_surrogate() {
+    if (high_surrogate_) {
+        append_utf8(0xfffd);
+        high_surrogate_ = 0;
+    }
+}
+
+void JsonStreamParser::append_utf8(uint32_t code_point) {
+    if (code_point < 0x80) {
+        token_ += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        token_ += static_cast<char>(0xc0 | code_point >> 6);
+        token_ += static_cast<char>(0x80 | (code_point & 0x3f));
+    } else if (code_point < 0x10000) {
+        token_ += static_cast<char>(0xe0 | code_point >> 12);
+        token_ += static_cast<char>(0x80 | (code_point >> 6 & 0x3f));
+        token_ += static_cast<char>(0x80 | (code_point & 0x3f));
+    } else {
+        token_ += static_cast<char>(0xf0 | code_point >> 18);
+        token_ += static_cast<char>(0x80 | (code_point >> 12 & 0x3f));
+        token_ += static_cast<char>(0x80 | (code_point >> 6 & 0x3f));
+        token_ += static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+}
+
+/**
+ * @brief Consume number bytes from i; the byte that ends it is left unread
+ */
+size_t JsonStreamParser::scan_number(const char* data, size_t size, size_t i) {
+    size_t start = i;
+    while (i < size && is_number_byte(data[i])) {
+        ++i;
+    }
+    token_.append(data + start, i - start);
+    if (token_.size() > MAX_TOKEN_BYTES) {
+        state_ = State::Error;
+        return i;
+    }
+    if (i < size) {
+        end_number();
+    }
+    return i;
+}
+
+bool JsonStreamParser::end_number() {
+    detail::ParsedNumber number;
+    if (!detail::parse_json_number(token_, number)) {
+        state_ = State::Error;
+        return false;
+    }
+    token_.clear();
+    value_done();
+    if (number.is_integer) {
+        handler_->integer(number.integer);
+    } else {
+        handler_->number(number.value);
+    }
+    return true;
+}
+
+} // namespace conduit
@@ -0,0 +1,257 @@
+#include "json_structural.hpp"
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CONDUIT_JSON_X86 1
+#include <immintrin.h>
+#endif
+
+namespace conduit {
+namespace detail {
+
+namespace {
+    constexpr size_t BLOCK = 64;
+
+    /**
+     * @brief One bit per input byte of a 64-byte block
+     */
+    struct BlockMasks {
+        uint64_t quote = 0;
+        uint64_t backslash = 0;
+        uint64_t op = 0;
+        uint64_t space = 0;
+    };
+
+    /**
+     * @brief Turns per-block character masks into token offsets
+     *
+     * Carries escape, string and token state across block boundaries. Only
+     * scalar bit arithmetic, so every classifier shares it.
+     */
+    class IndexBuilder {
+    public:
+        explicit IndexBuilder(std::vector<uint32_t>& index) : index_(index) {}
+
+        void add(const BlockMasks& masks, uint32_t base) {
+            uint64_t quotes = masks.quote & ~escaped(masks.backslash);
+
+            // Prefix XOR: bits from an opening quote up to (not including)
+            // its closing quote are set
+            uint64_t in_string = quotes;
+            in_string ^= in_string << 1;
+            in_string ^= in_string << 2;
+            in_string ^= in_string << 4;
+            in_string ^= in_string << 8;
+            in_string ^= in_string << 16;
+            in_string ^= in_string << 32;
+            in_string ^= string_carry_;
+            string_carry_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+            uint64_t outside = ~in_string;
+            uint64_t scalar = ~(masks.op | masks.space | masks.quote) & outside;
+            uint64_t scalar_start = scalar & ~(scalar << 1 | scalar_carry_);
+            scalar_carry_ = scalar >> 63;
+
+            uint64_t tokens = (masks.op & outside) | (quotes & in_string) | scalar_start;
+            append(tokens, base);
+        }
+
+        bool finish() const { return string_carry_ == 0; }
+
+    private:
+        std::vector<uint32_t>& index_;
+        uint64_t escape_carry_ = 0;     // first byte of the next block is escaped
+        uint64_t string_carry_ = 0;     // all ones while inside a string
+        uint64_t scalar_carry_ = 0;     // previous block ended inside a token
+
+        /**
+         * @brief Bytes preceded by an unescaped backslash
+         *
+         * Backslashes are rare outside string-heavy payloads, so this walks
+         * them one at a time rather than with carry tricks.
+         */
+        uint64_t escaped(uint64_t backslash) {
+            uint64_t result = escape_carry_;
+            backslash &= ~escape_carry_;
+            escape_carry_ = 0;
+
+            while (backslash) {
+                int bit = __builtin_ctzll(backslash);
+                if (bit == 63) {
+                    escape_carry_ = 1;
+                    break;
+                }
+                uint64_t next = 1ull << (bit + 1);
+                result |= next;
+                backslash &= ~((1ull << bit) | next);
+            }
+            return result;
+        }
+
+        void append(uint64_t tokens, uint32_t base) {
+            size_t count = static_cast<size_t>(__builtin_popcountll(tokens));
+            if (count == 0) {
+                return;
+            }
+            size_t at = index_.size();
+            index_.resize(at + count);
+            uint32_t* out = index_.data() + at;
+            while (tokens) {
+                *out++ = base + static_cast<uint32_t>(__builtin_ctzll(tokens));
+                tokens &= tokens - 1;
+            }
+        }
+    };
+
+    // Character classes for the scalar classifier
+    enum : uint8_t { QUOTE = 1, BACKSLASH = 2, OP = 4, SPACE = 8 };
+
+    struct ClassTable {
+        uint8_t classes[256] = {};
+
+        constexpr ClassTable() {
+            classes[static_cast<uint8_t>('"')] = QUOTE;
+            classes[static_cast<uint8_t>('\\')] = BACKSLASH;
+            for (char c : {'{', '}', '[', ']', ':', ','}) {
+                classes[static_cast<uint8_t>(c)] = OP;
+            }
+            for (char c : {' ', '\t', '\n', '\r'}) {
+                classes[static_cast<uint8_t>(c)] = SPACE;
+            }
+        }
+    };
+
+    constexpr ClassTable CLASS_TABLE;
+
+    void classify_scalar(const char* block, BlockMasks& masks) {
+        masks = BlockMasks{};
+        for (size_t i = 0; i < BLOCK; ++i) {
+            uint8_t c = CLASS_TABLE.classes[static_cast<uint8_t>(block[i])];
+            uint64_t bit = 1ull << i;
+            if (c & QUOTE) masks.quote |= bit;
+            if (c & BACKSLASH) masks.backslash |= bit;
+            if (c & OP) masks.op |= bit;
+            if (c & SPACE) masks.space |= bit;
+        }
+    }
+
+#ifdef CONDUIT_JSON_X86
+    // '[' and ']' differ from '{' and '}' only in bit 0x20, so OR-ing it in
+    // folds the brackets onto the braces and saves two compares
+
+    __attribute__((target("sse4.2")))
+    inline uint64_t mask(__m128i matches) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matches)));
+    }
+
+    __attribute__((target("sse4.2")))
+    void classify16(__m128i bytes, BlockMasks& masks, int shift) {
+        __m128i folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+        masks.quote |= mask(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('"'))) << shift;
+        masks.backslash |= mask(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\'))) << shift;
+        masks.op |= mask(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(':')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(','))))) << shift;
+        masks.space |= mask(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r'))))) << shift;
+    }
+
+    __attribute__((target("sse4.2")))
+    void classify_sse42(const char* block, BlockMasks& masks) {
+        masks = BlockMasks{};
+        for (int i = 0; i < 4; ++i) {
+            classify16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i)), masks, 16 * i);
+        }
+    }
+
+    __attribute__((target("avx2")))
+    inline uint64_t mask(__m256i matches) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(matches)));
+    }
+
+    __attribute__((target("avx2")))
+    void classify32(__m256i bytes, BlockMasks& masks, int shift) {
+        __m256i folded = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20));
+        masks.quote |= mask(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"'))) << shift;
+        masks.backslash |= mask(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\\'))) << shift;
+        masks.op |= mask(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')),
+                            _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(':')),
+                            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(','))))) << shift;
+        masks.space |= mask(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')),
+                            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')),
+                            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r'))))) << shift;
+    }
+
+    __attribute__((target("avx2")))
+    void classify_avx2(const char* block, BlockMasks& masks) {
+        masks = BlockMasks{};
+        classify32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)), masks, 0);
+        classify32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32)), masks, 32);
+    }
+#endif
+
+    template<void (*Classify)(const char*, BlockMasks&)>
+    bool scan(std::string_view input, std::vector<uint32_t>& index) {
+        IndexBuilder builder(index);
+        BlockMasks masks;
+
+        size_t whole = input.size() - input.size() % BLOCK;
+        for (size_t offset = 0; offset < whole; offset += BLOCK) {
+            Classify(input.data() + offset, masks);
+            builder.add(masks, static_cast<uint32_t>(offset));
+        }
+
+        if (whole < input.size()) {
+            // Pad the tail with whitespace, which never yields a token
+            char tail[BLOCK];
+            std::memset(tail, ' ', BLOCK);
+            std::memcpy(tail, input.data() + whole, input.size() - whole);
+            Classify(tail, masks);
+            builder.add(masks, static_cast<uint32_t>(whole));
+        }
+        return builder.finish();
+    }
+} // anonymous namespace
+
+SimdLevel detected_simd_level() {
+#ifdef CONDUIT_JSON_X86
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+        if (__builtin_cpu_supports("sse4.2")) return SimdLevel::Sse42;
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+bool build_structural_index(std::string_view input, std::vector<uint32_t>& index, SimdLevel level) {
+    index.clear();
+    if (input.size() > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    // Roughly one token per six bytes of typical API payloads
+    index.reserve(input.size() / 6 + 16);
+
+    switch (level) {
+#ifdef CONDUIT_JSON_X86
+        case SimdLevel::Avx2:
+            return scan<classify_avx2>(input, index);
+        case SimdLevel::Sse42:
+            return scan<classify_sse42>(input, index);
+#endif
+        default:
+            return scan<classify_scalar>(input, index);
+    }
+}
+
+} // namespace detail
+} // namespace conduit
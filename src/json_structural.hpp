@@ -0,0 +1,43 @@
+#ifndef CONDUIT_JSON_STRUCTURAL_HPP
+#define CONDUIT_JSON_STRUCTURAL_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace conduit {
+namespace detail {
+
+/**
+ * @brief Instruction set used to classify input in stage 1
+ */
+enum class SimdLevel {
+    Scalar,
+    Sse42,      // 16 bytes per compare
+    Avx2        // 32 bytes per compare
+};
+
+/**
+ * @brief Best level the running CPU supports, detected once
+ */
+SimdLevel detected_simd_level();
+
+/**
+ * @brief Stage 1 of the JSON parser: find every token start
+ *
+ * Scans the input 64 bytes at a time and appends, in order, the offset of
+ * each structural character ({ } [ ] : ,) outside strings, each opening
+ * quote, and the first byte of each other token (numbers, literals and
+ * stray bytes). Whitespace and string contents never appear. Stage 2 then
+ * walks this index instead of the bytes.
+ *
+ * @param level Must not exceed detected_simd_level()
+ * @return false if a string is left open or the input exceeds 4 GB
+ */
+bool build_structural_index(std::string_view input, std::vector<uint32_t>& index,
+                            SimdLevel level = detected_simd_level());
+
+} // namespace detail
+} // namespace conduit
+
+#endif // CONDUIT_JSON_STRUCTURAL_HPP
@@ -0,0 +1,184 @@
+#include "conduit.hpp"
+#include "json_number.hpp"
+#include "json_scan.hpp"
+
+namespace conduit {
+
+using detail::skip_space;
+using detail::skip_string;
+using detail::skip_value;
+
+namespace {
+    constexpr size_t npos = std::string_view::npos;
+
+    bool key_equals(std::string_view quoted, std::string_view key) {
+        std::string_view content = quoted.substr(1, quoted.size() - 2);
+        if (content.find('\\') == npos) {
+            return content == key;
+        }
+        std::string decoded;
+        return detail::decode_json_string(quoted, decoded) && decoded == key;
+    }
+} // anonymous namespace
+
+JsonView::JsonView(std::string_view json) {
+    size_t start = skip_space(json, 0);
+    if (start < json.size()) {
+        text_ = json.substr(start);
+    }
+}
+
+JsonType JsonView::type() const {
+    if (!exists()) {
+        return JsonType::Null;
+    }
+    switch (text_[0]) {
+        case 't': case 'f': return JsonType::Boolean;
+        case '"': return JsonType::String;
+        case '[': return JsonType::Array;
+        case '{': return JsonType::Object;
+        case '-': return JsonType::Number;
+        default:
+            return text_[0] >= '0' && text_[0] <= '9' ? JsonType::Number : JsonType::Null;
+    }
+}
+
+JsonView JsonView::operator[](std::string_view key) const {
+    if (!is_object()) {
+        return JsonView();
+    }
+
+    size_t i = skip_space(text_, 1);
+    if (i < text_.size() && text_[i] == '}') {
+        return JsonView();
+    }
+    while (i < text_.size() && text_[i] == '"') {
+        size_t key_end = skip_string(text_, i);
+        if (key_end == npos) {
+            break;
+        }
+        bool match = key_equals(text_.substr(i, key_end - i), key);
+
+        i = skip_space(text_, key_end);
+        if (i == text_.size() || text_[i] != ':') {
+            break;
+        }
+        i = skip_space(text_, i + 1);
+        if (i == text_.size()) {
+            break;
+        }
+        if (match) {
+            return JsonView(text_.substr(i), At{});
+        }
+
+        i = skip_value(text_, i);
+        if (i == npos) {
+            break;
+        }
+        i = skip_space(text_, i);
+        if (i == text_.size() || text_[i] != ',') {
+            break;
+        }
+        i = skip_space(text_, i + 1);
+    }
+    return JsonView();
+}
+
+JsonView JsonView::operator[](size_t index) const {
+    if (!is_array()) {
+        return JsonView();
+    }
+
+    size_t i = skip_space(text_, 1);
+    if (i < text_.size() && text_[i] == ']') {
+        return JsonView();
+    }
+    for (size_t position = 0; i < text_.size(); ++position) {
+        if (position == index) {
+            return JsonView(text_.substr(i), At{});
+        }
+        i = skip_value(text_, i);
+        if (i == npos) {
+            break;
+        }
+        i = skip_space(text_, i);
+        if (i == text_.size() || text_[i] != ',') {
+            break;
+        }
+        i = skip_space(text_, i + 1);
+    }
+    return JsonView();
+}
+
+std::string_view JsonView::raw() const {
+    size_t end = skip_value(text_, 0);
+    return end == npos ? std::string_view() : text_.substr(0, end);
+}
+
+std::optional<bool> JsonView::as_bool() const {
+    std::string_view text = raw();
+    if (text == "true") return true;
+    if (text == "false") return false;
+    return std::nullopt;
+}
+
+std::optional<double> JsonView::as_number() const {
+    detail::ParsedNumber number;
+    if (!is_number() || !detail::parse_json_number(raw(), number)) {
+        return std::nullopt;
+    }
+    return number.value;
+}
+
+std::optional<int> JsonView::as_int() const {
+    auto value = as_int64();
+    return value ? std::optional<int>(static_cast<int>(*value)) : std::nullopt;
+}
+
+std::optional<int64_t> JsonView::as_int64() const {
+    detail::ParsedNumber number;
+    if (!is_number() || !detail::parse_json_number(raw(), number)) {
+        return std::nullopt;
+    }
+    if (number.is_integer) {
+        return number.integer;
+    }
+    return detail::fits_int64(number.value) ? std::optional<int64_t>(static_cast<int64_t>(number.value))
+                                            : std::nullopt;
+}
+
+std::optional<std::string> JsonView::as_string() const {
+    if (!is_string()) {
+        return std::nullopt;
+    }
+    std::string_view quoted = raw();
+    if (quoted.empty()) {
+        return std::nullopt;
+    }
+
+    std::string_view content = quoted.substr(1, quoted.size() - 2);
+    for (char c : content) {
+        if (c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+            std::string decoded;
+            if (!detail::decode_json_string(quoted, decoded)) {
+                return std::nullopt;
+            }
+            return decoded;
+        }
+    }
+    return std::string(content);
+}
+
+std::optional<JsonValue> JsonView::to_value() const {
+    std::string_view text = raw();
+    if (text.empty()) {
+        return std::nullopt;
+    }
+    auto document = JsonDocument::parse_in_place(text);
+    if (!document) {
+        return std::nullopt;
+    }
+    return document->root().to_value();
+}
+
+} // namespace conduit
@@ -0,0 +1,184 @@
+#include "conduit.hpp"
+#include "json_number.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace conduit {
+
+namespace {
+    bool needs_escape(unsigned char c) { return c == '"' || c == '\\' || c < 0x20; }
+
+    /**
+     * @brief Length of the leading run of bytes that can be copied verbatim
+     *
+     * SSE2 is part of the x86-64 baseline, so this needs no runtime dispatch:
+     * 16 bytes are checked per step for a quote, a backslash or a control
+     * character (unsigned min(byte, 0x1f) == byte).
+     */
+    size_t safe_run(const char* data, size_t size) {
+        size_t i = 0;
+#ifdef __SSE2__
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control = _mm_set1_epi8(0x1f);
+        for (; i + 16 <= size; i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i special = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, backslash)),
+                _mm_cmpeq_epi8(_mm_min_epu8(bytes, control), bytes));
+            int mask = _mm_movemask_epi8(special);
+            if (mask != 0) {
+                return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+            }
+        }
+#endif
+        while (i < size && !needs_escape(static_cast<unsigned char>(data[i]))) {
+            ++i;
+        }
+        return i;
+    }
+} // anonymous namespace
+
+JsonWriter& JsonWriter::begin_object() {
+    separate();
+    out_->push_back('{');
+    comma_ = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::end_object() {
+    out_->push_back('}');
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::begin_array() {
+    separate();
+    out_->push_back('[');
+    comma_ = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::end_array() {
+    out_->push_back(']');
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(std::string_view name) {
+    separate();
+    write_escaped(name);
+    out_->push_back(':');
+    comma_ = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::string(std::string_view value) {
+    separate();
+    write_escaped(value);
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::number(double value) {
+    separate();
+    detail::append_json_number(*out_, value);
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::integer(int64_t value) {
+    separate();
+    detail::append_json_number(*out_, value);
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::unsigned_integer(uint64_t value) {
+    separate();
+    detail::append_json_number(*out_, value);
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::boolean(bool value) {
+    separate();
+    out_->append(value ? "true" : "false");
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+    separate();
+    out_->append("null");
+    comma_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(const JsonValue& value) {
+    switch (value.type()) {
+        case JsonType::Null:
+            return null();
+        case JsonType::Boolean:
+            return boolean(value.as_bool());
+        case JsonType::Number:
+            return value.is_integer() ? integer(value.as_int64()) : number(value.as_number());
+        case JsonType::String:
+            return string(value.as_string());
+        case JsonType::Array:
+            begin_array();
+            if (auto array = value.as_array()) {
+                for (const auto& element : *array) {
+                    this->value(*element);
+                }
+            }
+            return end_array();
+        case JsonType::Object:
+            begin_object();
+            if (auto object = value.as_object()) {
+                for (const auto& [name, member] : *object) {
+                    key(name);
+                    this->value(*member);
+                }
+            }
+            return end_object();
+    }
+    return null();
+}
+
+void JsonWriter::write_escaped(std::string_view text) {
+    static const char HEX[] = "0123456789abcdef";
+
+    out_->reserve(out_->size() + text.size() + 2);
+    out_->push_back('"');
+    size_t i = 0;
+    while (i < text.size()) {
+        size_t run = safe_run(text.data() + i, text.size() - i);
+        out_->append(text.data() + i, run);
+        i += run;
+        if (i == text.size()) {
+            break;
+        }
+
+        unsigned char c = static_cast<unsigned char>(text[i++]);
+        switch (c) {
+            case '"': out_->append("\\\""); break;
+            case '\\': out_->append("\\\\"); break;
+            case '\b': out_->append("\\b"); break;
+            case '\f': out_->append("\\f"); break;
+            case '\n': out_->append("\\n"); break;
+            case '\r': out_->append("\\r"); break;
+            case '\t': out_->append("\\t"); break;
+            default: {
+                char escape[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xf]};
+                out_->append(escape, sizeof(escape));
+                break;
+            }
+        }
+    }
+    out_->push_back('"');
+}
+
+} // namespace conduit
@@ -0,0 +1,343 @@
+#include "resolver.hpp"
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+
+namespace conduit {
+
+namespace {
+    /**
+     * @brief Parse an IPv4 or IPv6 literal (brackets allowed), port zero
+     */
+    bool parse_address(const std::string& text, Endpoint& endpoint) {
+        std::string host = text;
+        if (host.size() > 2 && host.front() == '[' && host.back() == ']') {
+            host = host.substr(1, host.size() - 2);
+        }
+
+        std::memset(&endpoint, 0, sizeof(endpoint));
+        auto* v4 = reinterpret_cast<sockaddr_in*>(&endpoint.addr);
+        if (inet_pton(AF_INET, host.c_str(), &v4->sin_addr) == 1) {
+            v4->sin_family = AF_INET;
+            endpoint.length = sizeof(sockaddr_in);
+            return true;
+        }
+
+        auto* v6 = reinterpret_cast<sockaddr_in6*>(&endpoint.addr);
+        if (inet_pton(AF_INET6, host.c_str(), &v6->sin6_addr) == 1) {
+            v6->sin6_family = AF_INET6;
+            endpoint.length = sizeof(sockaddr_in6);
+            return true;
+        }
+        return false;
+    }
+
+    EndpointList with_port(const EndpointList& addresses, int port) {
+        EndpointList endpoints = addresses;
+        for (auto& endpoint : endpoints) {
+            if (endpoint.addr.ss_family == AF_INET) {
+                reinterpret_cast<sockaddr_in*>(&endpoint.addr)->sin_port = htons(static_cast<uint16_t>(port));
+            } else {
+                reinterpret_cast<sockaddr_in6*>(&endpoint.addr)->sin6_port = htons(static_cast<uint16_t>(port));
+            }
+        }
+        return endpoints;
+    }
+
+    /**
+     * @brief Addresses from the override map or an address literal
+     */
+    bool resolve_static(const std::string& host, const ClientConfig& config, EndpointList& addresses) {
+        auto it = config.host_overrides.find(host);
+        if (it != config.host_overrides.end()) {
+            addresses.clear();
+            for (const auto& text : it->second) {
+                Endpoint endpoint;
+                if (!parse_address(text, endpoint)) {
+                    throw ConnectionException("Invalid override address for " + host + ": " + text);
+                }
+                addresses.push_back(endpoint);
+            }
+            return true;
+        }
+
+        Endpoint endpoint;
+        if (parse_address(host, endpoint)) {
+            addresses.assign(1, endpoint);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Blocking getaddrinfo; empty on failure
+     */
+    EndpointList query(const std::string& host) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        EndpointList addresses;
+        addrinfo* results = nullptr;
+        if (getaddrinfo(host.c_str(), nullptr, &hints, &results) != 0) {
+            return addresses;
+        }
+
+        for (addrinfo* ai = results; ai; ai = ai->ai_next) {
+            if (ai->ai_family != AF_INET && ai->ai_family != AF_INET6) {
+                continue;
+            }
+            Endpoint endpoint{};
+            std::memcpy(&endpoint.addr, ai->ai_addr, ai->ai_addrlen);
+            endpoint.length = ai->ai_addrlen;
+            addresses.push_back(endpoint);
+        }
+        freeaddrinfo(results);
+        return addresses;
+    }
+
+    ConnectionException resolution_failed(const std::string& host) {
+        return ConnectionException("Hostname resolution failed for: " + host);
+    }
+} // anonymous namespace
+
+Resolver& Resolver::shared() {
+    static Resolver resolver;
+    return resolver;
+}
+
+Resolver::~Resolver() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    jobs_ready_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+bool Resolver::lookup_locked(const std::string& host, int port, EndpointList& endpoints) {
+    auto it = cache_.find(host);
+    if (it == cache_.end()) {
+        return false;
+    }
+    if (it->second.expires <= Clock::now()) {
+        cache_.erase(it);
+        return false;
+    }
+    if (it->second.addresses.empty()) {
+        throw resolution_failed(host);
+    }
+    endpoints = with_port(it->second.addresses, port);
+    return true;
+}
+
+void Resolver::store(const std::string& host, const EndpointList& addresses, std::chrono::seconds ttl) {
+    if (ttl.count() <= 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cache_.size() >= MAX_CACHE_ENTRIES) {
+        auto now = Clock::now();
+        for (auto it = cache_.begin(); it != cache_.end();) {
+            it = it->second.expires <= now ? cache_.erase(it) : std::next(it);
+        }
+        if (cache_.size() >= MAX_CACHE_ENTRIES) {
+            cache_.erase(cache_.begin());
+        }
+    }
+    cache_[host] = CacheEntry{addresses, Clock::now() + ttl};
+}
+
+bool Resolver::try_resolve(const std::string& host, int port, const ClientConfig& config,
+                           EndpointList& endpoints) {
+    EndpointList addresses;
+    if (resolve_static(host, config, addresses)) {
+        endpoints = with_port(addresses, port);
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lookup_locked(host, port, endpoints);
+}
+
+EndpointList Resolver::resolve(const std::string& host, int port, const ClientConfig& config) {
+    EndpointList endpoints;
+    if (try_resolve(host, port, config, endpoints)) {
+        return endpoints;
+    }
+
+    EndpointList addresses = query(host);
+    store(host, addresses, addresses.empty() ? config.dns_negative_ttl : config.dns_ttl);
+    if (addresses.empty()) {
+        throw resolution_failed(host);
+    }
+    return with_port(addresses, port);
+}
+
+void Resolver::resolve_async(const std::string& host, int port, const ClientConfig& config, Callback done) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = in_flight_.find(host);
+        if (it != in_flight_.end()) {
+            // Piggyback on the query already running for this name
+            it->second.push_back(Waiter{port, std::move(done)});
+            return;
+        }
+        in_flight_[host].push_back(Waiter{port, std::move(done)});
+    }
+
+    std::chrono::seconds ttl = config.dns_ttl;
+    std::chrono::seconds negative_ttl = config.dns_negative_ttl;
+    enqueue([this, host, ttl, negative_ttl] {
+        EndpointList addresses = query(host);
+        store(host, addresses, addresses.empty() ? negative_ttl : ttl);
+
+        std::vector<Waiter> waiters;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = in_flight_.find(host);
+            waiters = std::move(it->second);
+            in_flight_.erase(it);
+        }
+
+        for (auto& waiter : waiters) {
+            if (addresses.empty()) {
+                waiter.done({}, std::make_exception_ptr(resolution_failed(host)));
+            } else {
+                waiter.done(with_port(addresses, waiter.port), nullptr);
+            }
+        }
+    });
+}
+
+size_t Resolver::prewarm(const std::vector<std::string>& hosts, const ClientConfig& config) {
+    struct Progress {
+        std::mutex mutex;
+        std::condition_variable finished;
+        size_t remaining = 0;
+        size_t resolved = 0;
+    };
+    auto progress = std::make_shared<Progress>();
+
+    for (const auto& host : hosts) {
+        EndpointList endpoints;
+        try {
+            if (try_resolve(host, 0, config, endpoints)) {
+                std::lock_guard<std::mutex> lock(progress->mutex);
+                ++progress->resolved;
+                continue;
+            }
+        } catch (const ConnectionException&) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(progress->mutex);
+            ++progress->remaining;
+        }
+        resolve_async(host, 0, config, [progress](EndpointList, std::exception_ptr error) {
+            std::lock_guard<std::mutex> lock(progress->mutex);
+            if (!error) {
+                ++progress->resolved;
+            }
+            if (--progress->remaining == 0) {
+                progress->finished.notify_all();
+            }
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(progress->mutex);
+    progress->finished.wait(lock, [&] { return progress->remaining == 0; });
+    return progress->resolved;
+}
+
+EndpointList Resolver::connect_order(const std::string& host, const EndpointList& endpoints) const {
+    int first_family = AF_INET6;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = winning_family_.find(host);
+        if (it != winning_family_.end()) {
+            first_family = it->second;
+        }
+    }
+
+    EndpointList preferred;
+    EndpointList other;
+    for (const auto& endpoint : endpoints) {
+        (endpoint.addr.ss_family == first_family ? preferred : other).push_back(endpoint);
+    }
+
+    EndpointList ordered;
+    ordered.reserve(endpoints.size());
+    for (size_t i = 0; i < preferred.size() || i < other.size(); ++i) {
+        if (i < preferred.size()) ordered.push_back(preferred[i]);
+        if (i < other.size()) ordered.push_back(other[i]);
+    }
+    return ordered;
+}
+
+void Resolver::remember_family(const std::string& host, int family) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (winning_family_.size() >= MAX_CACHE_ENTRIES && !winning_family_.count(host)) {
+        winning_family_.clear();
+    }
+    winning_family_[host] = family;
+}
+
+void Resolver::clear_cache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.clear();
+    winning_family_.clear();
+}
+
+size_t Resolver::cache_size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.size();
+}
+
+void Resolver::enqueue(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+        if (idle_workers_ == 0 && workers_.size() < MAX_WORKERS) {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+    jobs_ready_.notify_one();
+}
+
+void Resolver::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        ++idle_workers_;
+        jobs_ready_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+        --idle_workers_;
+        if (jobs_.empty()) {
+            return;
+        }
+
+        auto job = std::move(jobs_.front());
+        jobs_.pop_front();
+        lock.unlock();
+        job();
+        lock.lock();
+    }
+}
+
+// Public DNS helpers
+size_t prewarm_dns(const std::vector<std::string>& hosts, const ClientConfig& config) {
+    return Resolver::shared().prewarm(hosts, config);
+}
+
+void clear_dns_cache() {
+    Resolver::shared().clear_cache();
+}
+
+} // namespace conduit
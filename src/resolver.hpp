@@ -0,0 +1,126 @@
+#ifndef CONDUIT_RESOLVER_HPP
+#define CONDUIT_RESOLVER_HPP
+
+#include "conduit.hpp"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/socket.h>
+
+namespace conduit {
+
+/**
+ * @brief One address to try when connecting
+ */
+struct Endpoint {
+    sockaddr_storage addr;
+    socklen_t length;
+};
+
+using EndpointList = std::vector<Endpoint>;
+
+/**
+ * @brief getaddrinfo-based resolver with a process-wide cache
+ *
+ * Lookups go, in order, to ClientConfig::host_overrides, address literals,
+ * the cache and finally getaddrinfo. getaddrinfo does not report record
+ * TTLs, so successful answers live for ClientConfig::dns_ttl and failures
+ * for ClientConfig::dns_negative_ttl. Asynchronous lookups run on a small
+ * worker pool, and concurrent lookups of the same name share one query.
+ * All members are thread-safe.
+ */
+class Resolver {
+public:
+    using Callback = std::function<void(EndpointList endpoints, std::exception_ptr error)>;
+
+    static constexpr size_t MAX_WORKERS = 4;
+    static constexpr size_t MAX_CACHE_ENTRIES = 4096;
+
+    /**
+     * @brief The resolver shared by every client in the process
+     */
+    static Resolver& shared();
+
+    ~Resolver();
+
+    /**
+     * @brief Resolve on the calling thread; throws ConnectionException
+     */
+    EndpointList resolve(const std::string& host, int port, const ClientConfig& config);
+
+    /**
+     * @brief Answer from overrides, literals or the cache without blocking
+     * @return false if a real lookup is needed; throws ConnectionException
+     *         for a cached failure
+     */
+    bool try_resolve(const std::string& host, int port, const ClientConfig& config, EndpointList& endpoints);
+
+    /**
+     * @brief Resolve on a worker thread; done runs on that thread
+     */
+    void resolve_async(const std::string& host, int port, const ClientConfig& config, Callback done);
+
+    /**
+     * @brief Resolve hosts in parallel and wait for all of them
+     * @return Number of hosts that resolved
+     */
+    size_t prewarm(const std::vector<std::string>& hosts, const ClientConfig& config);
+
+    /**
+     * @brief Order endpoints for a Happy Eyeballs race (RFC 8305 section 4)
+     *
+     * Alternates address families, starting with the family that last won
+     * a race for host, or IPv6 if none has. Order within a family is kept.
+     */
+    EndpointList connect_order(const std::string& host, const EndpointList& endpoints) const;
+
+    /**
+     * @brief Remember the address family of a successful connection to host
+     */
+    void remember_family(const std::string& host, int family);
+
+    void clear_cache();
+    size_t cache_size() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct CacheEntry {
+        EndpointList addresses;     // port left at zero
+        Clock::time_point expires;
+    };
+
+    struct Waiter {
+        int port;
+        Callback done;
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, CacheEntry> cache_;
+    std::unordered_map<std::string, std::vector<Waiter>> in_flight_;
+    std::unordered_map<std::string, int> winning_family_;
+
+    std::condition_variable jobs_ready_;
+    std::deque<std::function<void()>> jobs_;
+    std::vector<std::thread> workers_;
+    size_t idle_workers_ = 0;
+    bool stopping_ = false;
+
+    Resolver() = default;
+
+    bool lookup_locked(const std::string& host, int port, EndpointList& endpoints);
+    void store(const std::string& host, const EndpointList& addresses, std::chrono::seconds ttl);
+    void enqueue(std::function<void()> job);
+    void worker_loop();
+};
+
+} // namespace conduit
+
+#endif // CONDUIT_RESOLVER_HPP
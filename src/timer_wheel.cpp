@@ -0,0 +1,85 @@
+#include "timer_wheel.hpp"
+#include <algorithm>
+
+namespace conduit {
+
+TimerWheel::TimerWheel() : start_(Clock::now()), slots_(SLOTS) {}
+
+uint64_t TimerWheel::tick_at(Clock::time_point time) const {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time - start_) / TICK);
+}
+
+TimerWheel::TimerId TimerWheel::add(std::chrono::milliseconds delay, std::function<void()> task) {
+    uint64_t ticks = static_cast<uint64_t>(std::max<int64_t>(0, (delay + TICK - std::chrono::milliseconds(1)) / TICK));
+    // Never schedule into a tick that has already been processed
+    uint64_t deadline = std::max(tick_at(Clock::now()) + ticks, current_tick_ + 1);
+
+    TimerId id = next_id_++;
+    timers_.emplace(id, Timer{deadline, std::move(task)});
+    slots_[deadline % SLOTS].push_back(id);
+    return id;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    return timers_.erase(id) > 0;
+}
+
+int TimerWheel::next_timeout_ms() const {
+    if (timers_.empty()) {
+        return -1;
+    }
+
+    auto now = Clock::now();
+    uint64_t tick = current_tick_ + 1;
+    for (size_t i = 0; i < SLOTS && slots_[tick % SLOTS].empty(); ++i) {
+        ++tick;
+    }
+
+    auto due = start_ + tick * TICK;
+    if (due <= now) {
+        return 0;
+    }
+    auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(due - now);
+    return static_cast<int>(wait.count()) + 1;
+}
+
+void TimerWheel::collect(size_t slot, uint64_t up_to, std::vector<std::function<void()>>& due) {
+    auto& ids = slots_[slot];
+    size_t kept = 0;
+    for (TimerId id : ids) {
+        auto it = timers_.find(id);
+        if (it == timers_.end()) {
+            continue;
+        }
+        if (it->second.deadline_tick <= up_to) {
+            due.push_back(std::move(it->second.task));
+            timers_.erase(it);
+            continue;
+        }
+        ids[kept++] = id;
+    }
+    ids.resize(kept);
+}
+
+std::vector<std::function<void()>> TimerWheel::expire(Clock::time_point now) {
+    std::vector<std::function<void()>> due;
+    uint64_t target = tick_at(now);
+    if (target <= current_tick_) {
+        return due;
+    }
+
+    if (target - current_tick_ >= SLOTS) {
+        // Slept through a whole revolution: every slot is due for a look
+        for (size_t slot = 0; slot < SLOTS; ++slot) {
+            collect(slot, target, due);
+        }
+    } else {
+        for (uint64_t tick = current_tick_ + 1; tick <= target; ++tick) {
+            collect(tick % SLOTS, target, due);
+        }
+    }
+    current_tick_ = target;
+    return due;
+}
+
+} // namespace conduit
@@ -0,0 +1,75 @@
+#ifndef CONDUIT_TIMER_WHEEL_HPP
+#define CONDUIT_TIMER_WHEEL_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace conduit {
+
+/**
+ * @brief Hashed timing wheel for request deadlines
+ *
+ * Timers land in the slot for their expiry tick; a slot is only examined
+ * when the wheel's clock passes it, so arming and cancelling are O(1) no
+ * matter how many timers are pending. Timers further out than one
+ * revolution stay in their slot until a later pass reaches their tick.
+ * Cancelled timers are dropped from their slot lazily.
+ */
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+
+    static constexpr std::chrono::milliseconds TICK{1};
+    static constexpr size_t SLOTS = 1024;
+
+    TimerWheel();
+
+    TimerId add(std::chrono::milliseconds delay, std::function<void()> task);
+
+    /**
+     * @return true if the timer was pending and will no longer fire
+     */
+    bool cancel(TimerId id);
+
+    bool empty() const { return timers_.empty(); }
+    size_t size() const { return timers_.size(); }
+
+    /**
+     * @brief Milliseconds until the next occupied slot, or -1 if none
+     *
+     * May be early (a slot holding only cancelled or far-future timers)
+     * but never late.
+     */
+    int next_timeout_ms() const;
+
+    /**
+     * @brief Remove every timer due at now and return their tasks
+     *
+     * Tasks are returned rather than run so they can add or cancel timers.
+     */
+    std::vector<std::function<void()>> expire(Clock::time_point now);
+
+private:
+    struct Timer {
+        uint64_t deadline_tick;
+        std::function<void()> task;
+    };
+
+    Clock::time_point start_;
+    uint64_t current_tick_ = 0;
+    TimerId next_id_ = 1;
+    std::unordered_map<TimerId, Timer> timers_;
+    std::vector<std::vector<TimerId>> slots_;
+
+    uint64_t tick_at(Clock::time_point time) const;
+    void collect(size_t slot, uint64_t up_to, std::vector<std::function<void()>>& due);
+};
+
+} // namespace conduit
+
+#endif // CONDUIT_TIMER_WHEEL_HPP
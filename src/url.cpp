@@ -0,0 +1,497 @@
+#include "conduit.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace conduit {
+
+namespace {
+    constexpr size_t npos = std::string_view::npos;
+    constexpr size_t BASE_URL_CACHE_CAPACITY = 64;
+
+    bool is_alpha(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    bool is_digit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    int hex_value(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    /**
+     * @brief Whether text[i] starts a well-formed %XX escape
+     */
+    bool is_escape(std::string_view text, size_t i) {
+        return i + 2 < text.size() && hex_value(text[i + 1]) >= 0 && hex_value(text[i + 2]) >= 0;
+    }
+
+    bool is_unreserved(char c) {
+        return is_alpha(c) || is_digit(c) || c == '-' || c == '.' || c == '_' || c == '~';
+    }
+
+    bool is_sub_delim(char c) {
+        switch (c) {
+            case '!': case '$': case '&': case '\'': case '(': case ')':
+            case '*': case '+': case ',': case ';': case '=':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * @brief Visible characters and well-formed escapes only
+     */
+    bool is_valid_component(std::string_view text) {
+        for (size_t i = 0; i < text.size(); ++i) {
+            char c = text[i];
+            if (c == '%') {
+                if (!is_escape(text, i)) {
+                    return false;
+                }
+                i += 2;
+            } else if (static_cast<unsigned char>(c) <= ' ' || c == 0x7f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief A registered name: unreserved, sub-delims and escapes (RFC 3986 section 3.2.2)
+     */
+    bool is_valid_reg_name(std::string_view host) {
+        if (host.empty()) {
+            return false;
+        }
+        for (size_t i = 0; i < host.size(); ++i) {
+            if (host[i] == '%') {
+                if (!is_escape(host, i)) {
+                    return false;
+                }
+                i += 2;
+            } else if (!is_unreserved(host[i]) && !is_sub_delim(host[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief The inside of [...]: an IPv6 address with an optional %25 zone (RFC 6874)
+     *
+     * Only the alphabet is checked here; the resolver rejects bad addresses.
+     */
+    bool is_valid_ipv6_literal(std::string_view literal) {
+        size_t zone = literal.find("%25");
+        std::string_view address = literal.substr(0, zone);
+        if (address.find(':') == npos) {
+            return false;
+        }
+        for (char c : address) {
+            if (hex_value(c) < 0 && c != ':' && c != '.') {
+                return false;
+            }
+        }
+        return zone == npos || is_valid_reg_name(literal.substr(zone + 3));
+    }
+
+    /**
+     * @brief Whether a percent-decoded host name is free of bytes that would
+     *        split a Host header or an authority
+     */
+    bool is_safe_decoded_host(std::string_view host) {
+        for (char c : host) {
+            if (static_cast<unsigned char>(c) <= ' ' || c == 0x7f || c == ':' || c == '/' || c == '@') {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Length of the scheme if url starts with "scheme://", npos otherwise
+     */
+    size_t scheme_length(std::string_view url) {
+        if (url.empty() || !is_alpha(url[0])) {
+            return npos;
+        }
+        size_t i = 1;
+        while (i < url.size() && (is_alpha(url[i]) || is_digit(url[i]) || url[i] == '+' || url[i] == '-' ||
+                                  url[i] == '.')) {
+            ++i;
+        }
+        return url.compare(i, 3, "://") == 0 ? i : npos;
+    }
+
+    bool equals_lower(std::string_view text, std::string_view lower) {
+        if (text.size() != lower.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < text.size(); ++i) {
+            char c = text[i];
+            if ((c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c) != lower[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int default_port(std::string_view scheme) {
+        if (equals_lower(scheme, "http")) return 80;
+        if (equals_lower(scheme, "https")) return 443;
+        return -1;
+    }
+
+    /**
+     * @brief Scheme, userinfo, host and port from "scheme://authority"
+     */
+    bool parse_base(std::string_view base, size_t scheme_size, UrlView& view) {
+        view.scheme = base.substr(0, scheme_size);
+        std::string_view authority = base.substr(scheme_size + 3);
+
+        size_t at = authority.rfind('@');
+        if (at != npos) {
+            view.userinfo = authority.substr(0, at);
+            if (!is_valid_component(view.userinfo)) {
+                return false;
+            }
+            authority.remove_prefix(at + 1);
+        }
+
+        std::string_view rest;
+        if (!authority.empty() && authority[0] == '[') {
+            size_t close = authority.find(']');
+            if (close == npos || !is_valid_ipv6_literal(authority.substr(1, close - 1))) {
+                return false;
+            }
+            view.host = authority.substr(0, close + 1);
+            rest = authority.substr(close + 1);
+        } else {
+            size_t colon = authority.find(':');
+            view.host = authority.substr(0, colon);
+            if (!is_valid_reg_name(view.host)) {
+                return false;
+            }
+            rest = colon == npos ? std::string_view() : authority.substr(colon);
+        }
+
+        // An empty port after the colon means the default (RFC 3986 section 3.2.3)
+        view.port = default_port(view.scheme);
+        if (rest.empty() || rest == ":") {
+            return true;
+        }
+        if (rest[0] != ':' || rest.size() > 6) {
+            return false;
+        }
+        int port = 0;
+        for (char c : rest.substr(1)) {
+            if (!is_digit(c)) {
+                return false;
+            }
+            port = port * 10 + (c - '0');
+        }
+        view.port = port;
+        return port > 0 && port <= 65535;
+    }
+
+    /**
+     * @brief Path, query and fragment from what follows the authority
+     */
+    bool parse_target(std::string_view target, UrlView& view) {
+        size_t query = npos;
+        size_t fragment = npos;
+        for (size_t i = 0; i < target.size() && fragment == npos; ++i) {
+            char c = target[i];
+            if (c == '%') {
+                if (!is_escape(target, i)) {
+                    return false;
+                }
+                i += 2;
+            } else if (static_cast<unsigned char>(c) <= ' ' || c == 0x7f) {
+                return false;
+            } else if (c == '#') {
+                fragment = i;
+            } else if (c == '?' && query == npos) {
+                query = i;
+            }
+        }
+
+        size_t end = fragment == npos ? target.size() : fragment;
+        view.path = target.substr(0, query == npos ? end : query);
+        view.query = query == npos ? std::string_view() : target.substr(query + 1, end - query - 1);
+        if (fragment != npos) {
+            view.fragment = target.substr(fragment + 1);
+            return is_valid_component(view.fragment);
+        }
+        return true;
+    }
+
+    using ByteSet = std::array<bool, 256>;
+
+    constexpr ByteSet make_unreserved_set(bool form) {
+        ByteSet set{};
+        for (int c = 0; c < 256; ++c) {
+            set[c] = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                     c == '-' || c == '.' || c == '_' || (form ? c == '*' : c == '~');
+        }
+        return set;
+    }
+
+    // Bytes copied as they are: RFC 3986 unreserved for queries, the WHATWG
+    // application/x-www-form-urlencoded set for forms
+    constexpr ByteSet QUERY_SAFE = make_unreserved_set(false);
+    constexpr ByteSet FORM_SAFE = make_unreserved_set(true);
+
+    /**
+     * @brief Percent-encode text onto out, sized once for the worst case
+     *
+     * Runs of safe bytes are copied whole; only the bytes between them are
+     * looked at one by one.
+     */
+    void append_encoded(std::string& out, std::string_view text, const ByteSet& safe, bool plus_for_space) {
+        static constexpr char HEX[] = "0123456789ABCDEF";
+        size_t start = out.size();
+        out.resize(start + text.size() * 3);
+        char* p = &out[start];
+
+        size_t i = 0;
+        while (i < text.size()) {
+            size_t run = i;
+            while (run < text.size() && safe[static_cast<unsigned char>(text[run])]) {
+                ++run;
+            }
+            std::memcpy(p, text.data() + i, run - i);
+            p += run - i;
+            if (run == text.size()) {
+                break;
+            }
+
+            auto c = static_cast<unsigned char>(text[run]);
+            if (c == ' ' && plus_for_space) {
+                *p++ = '+';
+            } else {
+                p[0] = '%';
+                p[1] = HEX[c >> 4];
+                p[2] = HEX[c & 0xf];
+                p += 3;
+            }
+            i = run + 1;
+        }
+        out.resize(static_cast<size_t>(p - out.data()));
+    }
+
+    void append_integer(std::string& out, int64_t value) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(digits, result.ptr);
+    }
+
+    /**
+     * @brief Scheme and authority of recent URLs, least recently used evicted
+     *
+     * Keyed on the text up to the path, so all URLs of one service share an
+     * entry. The entries hold only the ParsedUrl base fields.
+     */
+    class BaseUrlCache {
+    public:
+        bool find(std::string_view base, ParsedUrl& out) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(base);
+            if (it == index_.end()) {
+                return false;
+            }
+            entries_.splice(entries_.begin(), entries_, it->second);
+            const ParsedUrl& cached = it->second->second;
+            out.scheme = cached.scheme;
+            out.userinfo = cached.userinfo;
+            out.host = cached.host;
+            out.port = cached.port;
+            return true;
+        }
+
+        void insert(std::string_view base, const ParsedUrl& parsed) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (index_.find(base) != index_.end()) {
+                return;
+            }
+            entries_.emplace_front(std::string(base), parsed);
+            index_.emplace(entries_.front().first, entries_.begin());
+            if (entries_.size() > BASE_URL_CACHE_CAPACITY) {
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+
+    private:
+        using Entries = std::list<std::pair<std::string, ParsedUrl>>;
+
+        std::mutex mutex_;
+        Entries entries_;
+        std::unordered_map<std::string_view, Entries::iterator> index_;  // keys point into entries_
+    };
+
+    BaseUrlCache& base_url_cache() {
+        static BaseUrlCache cache;
+        return cache;
+    }
+} // anonymous namespace
+
+std::optional<UrlView> parse_url_view(std::string_view url) {
+    size_t scheme_size = scheme_length(url);
+    if (scheme_size == npos) {
+        return std::nullopt;
+    }
+    size_t base_end = std::min(url.find_first_of("/?#", scheme_size + 3), url.size());
+
+    UrlView view;
+    if (!parse_base(url.substr(0, base_end), scheme_size, view) || !parse_target(url.substr(base_end), view)) {
+        return std::nullopt;
+    }
+    return view;
+}
+
+std::string percent_decode(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '%' && is_escape(text, i)) {
+            out.push_back(static_cast<char>(hex_value(text[i + 1]) * 16 + hex_value(text[i + 2])));
+            i += 2;
+        } else {
+            out.push_back(text[i]);
+        }
+    }
+    return out;
+}
+
+ParsedUrl parse_url(const std::string& url) {
+    std::string_view text = url;
+    size_t scheme_size = scheme_length(text);
+    if (scheme_size == npos) {
+        throw std::invalid_argument("Invalid URL format: " + url);
+    }
+    size_t base_end = std::min(text.find_first_of("/?#", scheme_size + 3), text.size());
+    std::string_view base = text.substr(0, base_end);
+
+    ParsedUrl result;
+    UrlView view;
+    if (!base_url_cache().find(base, result)) {
+        if (!parse_base(base, scheme_size, view) || default_port(view.scheme) < 0) {
+            throw std::invalid_argument("Invalid URL format: " + url);
+        }
+        result.scheme = view.scheme.size() == 4 ? "http" : "https";
+        result.userinfo.assign(view.userinfo);
+        std::string_view host = view.host;
+        bool literal = host.front() == '[';
+        if (literal) {
+            host = host.substr(1, host.size() - 2);
+        }
+        if (host.find('%') == npos) {
+            result.host.assign(host);
+        } else {
+            // Escapes may only decode to name characters; in a literal
+            // they are confined to the zone after the "%25"
+            result.host = percent_decode(host);
+            std::string_view decoded = result.host;
+            if (literal) {
+                decoded.remove_prefix(decoded.find('%') + 1);
+            }
+            if (!is_safe_decoded_host(decoded)) {
+                throw std::invalid_argument("Invalid URL format: " + url);
+            }
+        }
+        result.port = view.port;
+        base_url_cache().insert(base, result);
+    }
+
+    if (!parse_target(text.substr(base_end), view)) {
+        throw std::invalid_argument("Invalid URL format: " + url);
+    }
+    result.path = view.path.empty() ? std::string("/") : std::string(view.path);
+    result.query.assign(view.query);
+    result.fragment.assign(view.fragment);
+    return result;
+}
+
+std::string ParsedUrl::target() const {
+    std::string target;
+    target.reserve(path.size() + 1 + query.size());
+    target.append(path);
+    if (!query.empty()) {
+        target.append("?").append(query);
+    }
+    return target;
+}
+
+std::string percent_encode(std::string_view text) {
+    std::string out;
+    append_encoded(out, text, QUERY_SAFE, false);
+    return out;
+}
+
+QueryBuilder::QueryBuilder(std::string_view base) : buffer_(base), base_size_(base.size()) {
+    if (!base.empty() && base.back() != '?' && base.back() != '&') {
+        first_separator_ = base.find('?') == npos ? '?' : '&';
+    }
+    separator_ = first_separator_;
+}
+
+void QueryBuilder::begin_parameter(std::string_view name) {
+    if (separator_) {
+        buffer_.push_back(separator_);
+    }
+    separator_ = '&';
+    append_encoded(buffer_, name, QUERY_SAFE, false);
+    buffer_.push_back('=');
+}
+
+QueryBuilder& QueryBuilder::add(std::string_view name, std::string_view value) {
+    begin_parameter(name);
+    append_encoded(buffer_, value, QUERY_SAFE, false);
+    return *this;
+}
+
+QueryBuilder& QueryBuilder::add(std::string_view name, int64_t value) {
+    begin_parameter(name);
+    append_integer(buffer_, value);
+    return *this;
+}
+
+void QueryBuilder::clear() {
+    buffer_.resize(base_size_);
+    separator_ = first_separator_;
+}
+
+void FormBody::begin_field(std::string_view name) {
+    if (!buffer_.empty()) {
+        buffer_.push_back('&');
+    }
+    append_encoded(buffer_, name, FORM_SAFE, true);
+    buffer_.push_back('=');
+}
+
+FormBody& FormBody::add(std::string_view name, std::string_view value) {
+    begin_field(name);
+    append_encoded(buffer_, value, FORM_SAFE, true);
+    return *this;
+}
+
+FormBody& FormBody::add(std::string_view name, int64_t value) {
+    begin_field(name);
+    append_integer(buffer_, value);
+    return *this;
+}
+
+} // namespace conduit
@@ -2,9 +2,19 @@
 #include <cassert>
 #include <string>
 #include <memory>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 // We'll include the header directly for testing
 #include "../include/conduit.hpp"
+#include "json_structural.hpp"
 
 // Simple test functions
 void test_json_parsing() {
@@ -56,6 +66,620 @@ void test_json_serialization() {
     std::cout << "✓ JSON serialization tests passed" << std::endl;
 }
 
+void test_json_document() {
+    std::cout << "Testing arena JSON documents..." << std::endl;
+
+    std::string json_str = R"({
+        "name": "Test User",
+        "age": 25,
+        "ratio": -1.5e2,
+        "active": true,
+        "tags": ["a", "b\n", "\u00e9\ud83d\ude00"],
+        "nested": {"empty": {}, "none": null, "list": []},
+        "age": 26
+    })";
+
+    auto doc = conduit::JsonDocument::parse(json_str);
+    assert(doc.has_value());
+    const conduit::JsonNode& root = doc->root();
+    assert(root.is_object());
+    assert(root.size() == 7);
+
+    // Same accessors as JsonValue; the last duplicate key wins, as there
+    assert(root.get_string("name") == std::optional<std::string>("Test User"));
+    assert(root.get_int("age") == 26);
+    assert(root.get_number("ratio") == -150.0);
+    assert(root.get_bool("active") == true);
+    assert(!root.get_int("name").has_value());
+    assert(!root.get_string("missing").has_value());
+
+    const conduit::JsonNode* tags = root.find("tags");
+    assert(tags && tags->is_array() && tags->size() == 3);
+    assert((*tags)[1].as_string() == "b\n");
+    assert((*tags)[2].as_string() == "\xc3\xa9\xf0\x9f\x98\x80");
+
+    const conduit::JsonNode* nested = root.find("nested");
+    assert(nested->find("empty")->is_object() && nested->find("empty")->size() == 0);
+    assert(nested->find("none")->is_null());
+    assert(nested->find("list")->elements().empty());
+
+    size_t members = 0;
+    for (const auto& member : root.members()) {
+        assert(member.key.is_string());
+        ++members;
+    }
+    assert(members == 7);
+
+    // Converts to the shared_ptr DOM for existing code
+    conduit::JsonValue value = root.to_value();
+    assert(value.get_string("name") == std::optional<std::string>("Test User"));
+    assert(value.as_object()->at("tags")->as_array()->size() == 3);
+
+    // Malformed input is rejected rather than partially parsed
+    for (const char* bad : {"", "{", "[1,]", "{\"a\" 1}", "01x", "\"tab\there\"", "[1] 2", "tru", "\"\\x\""}) {
+        assert(!conduit::JsonDocument::parse(bad).has_value());
+    }
+    assert(!conduit::JsonDocument::parse(std::string(5000, '[')).has_value());
+
+    // Nodes are 16 bytes each, in a few blocks rather than one allocation apiece
+    std::string big = "[";
+    for (int i = 0; i < 100000; ++i) {
+        big += (i ? ",{\"id\":" : "{\"id\":") + std::to_string(i) + "}";
+    }
+    big += "]";
+    auto big_doc = conduit::JsonDocument::parse(big);
+    assert(big_doc && big_doc->root().size() == 100000);
+    assert(big_doc->root()[99999].get_int("id") == 99999);
+    assert(big_doc->memory_usage() < 16 * 1024 * 1024);
+
+    conduit::JsonDocument moved = std::move(*big_doc);
+    assert(moved.root()[5].get_int("id") == 5);
+
+    // In place: plain strings point into the input, escaped ones are decoded
+    std::string body = R"({"plain": "abc", "esc\u0061ped": "a\nb", "list": ["x", "\"y\""]})";
+    auto in_place = conduit::JsonDocument::parse_in_place(body);
+    assert(in_place);
+    const char* begin = body.data();
+    const char* end = body.data() + body.size();
+    auto inside = [&](std::string_view text) { return text.data() >= begin && text.data() < end; };
+    std::string_view plain = in_place->root().find("plain")->as_string();
+    assert(plain == "abc" && inside(plain));
+    const auto& escaped = in_place->root().members()[1];
+    assert(escaped.key.as_string() == "escaped" && !inside(escaped.key.as_string()));
+    assert(escaped.value.as_string() == "a\nb" && !inside(escaped.value.as_string()));
+    assert(inside(in_place->root().find("list")->elements()[0].as_string()));
+    assert(in_place->root().find("list")->elements()[1].as_string() == "\"y\"");
+    assert(!inside(conduit::JsonDocument::parse(body)->root().find("plain")->as_string()));
+    assert(!conduit::JsonDocument::parse_in_place(R"({"a": "b\q"})"));
+
+    conduit::Response response(200, body, {{"Content-Type", "application/json"}});
+    auto from_response = response.json_document();
+    assert(from_response && from_response->root().get_string("plain") == "abc");
+    assert(from_response->root().find("plain")->as_string().data() > response.body().data());
+    assert(!conduit::Response(200, body, {}).json_document());
+
+    // parse_json takes any string_view, such as part of a larger buffer
+    std::string_view framed = "data: [1, \"two\"]\n\n";
+    auto slice = conduit::parse_json(framed.substr(6, 12));
+    assert(slice && slice->as_array()->at(1)->as_string() == "two");
+    assert(conduit::parse_json(std::string_view(body))->get_string("escaped") == "a\nb");
+
+    std::cout << "✓ Arena JSON document tests passed" << std::endl;
+}
+
+void test_structural_index() {
+    std::cout << "Testing JSON structural index..." << std::endl;
+    using conduit::detail::SimdLevel;
+    using conduit::detail::build_structural_index;
+
+    std::vector<uint32_t> index;
+    assert(build_structural_index(R"( {"a\"b": [1, -2.5e3, true]} )", index));
+    assert((index == std::vector<uint32_t>{1, 2, 8, 10, 11, 12, 14, 20, 22, 26, 27}));
+
+    // Every supported classifier must produce the same index, including
+    // across 64-byte block edges and for backslash runs of either parity
+    std::vector<std::string> inputs = {
+        "", "{}", "\"open", R"("\\")", R"(["\\\"", 1])",
+        std::string(63, ' ') + "\"" + std::string(61, '\\') + "\" ,1]",
+        std::string(62, ' ') + "[\"" + std::string(65, '\\') + "\"\"]",
+        "[" + std::string(200, '7') + ",\"x\"]",
+    };
+    std::mt19937 rng(12345);
+    const char alphabet[] = "{}[]:, \t\n\"\\ab1-.e";
+    for (int i = 0; i < 500; ++i) {
+        std::string random(rng() % 300, ' ');
+        for (char& c : random) {
+            c = alphabet[rng() % (sizeof(alphabet) - 1)];
+        }
+        inputs.push_back(random);
+    }
+
+    for (const auto& input : inputs) {
+        std::vector<uint32_t> expected;
+        bool closed = build_structural_index(input, expected, SimdLevel::Scalar);
+        for (SimdLevel level : {SimdLevel::Sse42, SimdLevel::Avx2}) {
+            if (level > conduit::detail::detected_simd_level()) break;
+            std::vector<uint32_t> actual;
+            assert(build_structural_index(input, actual, level) == closed);
+            assert(actual == expected);
+        }
+    }
+    assert(!build_structural_index(inputs[2], index));
+    assert(!build_structural_index(inputs[5], index));
+    assert(build_structural_index(inputs[6], index));
+
+    // parse_json goes through the index and keeps its old results
+    auto parsed = conduit::parse_json(R"({"k": "v\"\\", "n": [0, 1e2, -0.5]} )");
+    assert(parsed && parsed->get_string("k") == std::optional<std::string>("v\"\\"));
+    assert(parsed->as_object()->at("n")->as_array()->at(1)->as_number() == 100.0);
+    for (const char* bad : {"[1 2]", "{\"a\":1,}", "\"a\"\"b\"", "[1-2]", "nul", " "}) {
+        assert(!conduit::parse_json(bad).has_value());
+    }
+
+    std::cout << "✓ JSON structural index tests passed" << std::endl;
+}
+
+void test_json_view() {
+    std::cout << "Testing on-demand JSON views..." << std::endl;
+
+    std::string body = R"( {
+        "skip": {"deep": [1, {"x": "]}\"{["}], "s": "a\\\"b"},
+        "data": {"id": 42, "name": "caf\u00e9", "ok": false, "ratio": -2.5e1, "none": null},
+        "items": [10, "twenty", [30], {"n": 40}],
+        "we\u0069rd": 7,
+        "data": "second"
+    } )";
+    conduit::JsonView root(body);
+    assert(root.is_object());
+
+    auto data = root["data"];
+    assert(data.is_object());
+    assert(data["id"].as_int() == 42);
+    assert(data["name"].as_string() == std::optional<std::string>("caf\xc3\xa9"));
+    assert(data["ok"].as_bool() == false);
+    assert(data["ratio"].as_number() == -25.0);
+    assert(data["none"].is_null() && data["none"].exists());
+    assert(!data["absent"].exists());
+    assert(!data["id"].as_string().has_value());
+
+    // Arrays, escaped keys, chaining through missing values
+    assert(root["items"][1].as_string() == std::optional<std::string>("twenty"));
+    assert(root["items"][2][0].as_int() == 30);
+    assert(root["items"][3]["n"].as_int() == 40);
+    assert(!root["items"][4].exists());
+    assert(root["weird"].as_int() == 7);
+    assert(!root["missing"]["a"][0].exists());
+    assert(root["skip"]["deep"][1]["x"].as_string() == std::optional<std::string>("]}\"{["));
+
+    assert(root["items"][3].raw() == R"({"n": 40})");
+    auto items = root["items"].to_value();
+    assert(items && items->as_array()->size() == 4);
+
+    // Malformed text is reported where it is read, not up front
+    conduit::JsonView broken(R"({"a": 1, "b": [1, 2)");
+    assert(broken["a"].as_int() == 1);
+    assert(broken["b"].raw().empty());
+    assert(!broken["c"].exists());
+    assert(!conduit::JsonView(R"({"n": 01})")["n"].as_number().has_value());
+    assert(!conduit::JsonView("   ").exists());
+
+    // Escapes decode the same way through the view, the reader and the document
+    const std::pair<const char*, const char*> escapes[] = {
+        {R"("a\n\t\/\\\"b")", "a\n\t/\\\"b"},
+        {R"("caf\u00E9 \ud83d\ude00")", "caf\xc3\xa9 \xf0\x9f\x98\x80"},
+        {R"("\ud800x\udc00")", "\xef\xbf\xbdx\xef\xbf\xbd"},
+    };
+    for (const auto& [text, expected] : escapes) {
+        assert(conduit::JsonView(text).as_string() == std::optional<std::string>(expected));
+        assert(conduit::from_json<std::string>(text) == std::optional<std::string>(expected));
+        assert(conduit::JsonDocument::parse(text)->root().as_string() == expected);
+    }
+    const char* bad_escapes[] = {R"("\x")", R"("\u12g4")", R"("\u12")", R"("\ud800\u12")", "\"a\tb\""};
+    for (const char* text : bad_escapes) {
+        assert(!conduit::JsonView(text).as_string().has_value());
+        assert(!conduit::from_json<std::string>(text));
+        assert(!conduit::JsonDocument::parse(text));
+    }
+    assert(conduit::JsonView(R"({"k\u0065y": 1, "key": 2})")["key"].as_int() == 1);
+    assert(!conduit::JsonView(R"({"k\q": 1})")["k\\q"].exists());
+
+    // Response parses lazily and offers the same view over its body
+    conduit::Response response(200, body, {{"Content-Type", "application/json; charset=utf-8"}});
+    assert(response.json_view()["data"]["id"].as_int() == 42);
+    assert(response.json().has_value());
+    assert(response.json()->get_string("data") == std::optional<std::string>("second"));
+    conduit::Response text(200, body, {{"Content-Type", "text/plain"}});
+    assert(!text.json().has_value() && !text.json_view().exists());
+
+    std::cout << "✓ On-demand JSON view tests passed" << std::endl;
+}
+
+/**
+ * @brief Records JsonStreamParser events as text for comparison
+ */
+class RecordingHandler : public conduit::JsonHandler {
+public:
+    std::string log;
+    const char* last_string = nullptr;
+
+    void start_object() override { log += "{"; }
+    void end_object() override { log += "}"; }
+    void start_array() override { log += "["; }
+    void end_array() override { log += "]"; }
+    void key(std::string_view name) override { log += "k:" + std::string(name) + ";"; }
+    void string(std::string_view value) override {
+        log += "s:" + std::string(value) + ";";
+        last_string = value.data();
+    }
+    void number(double value) override { log += "n:" + std::to_string(value) + ";"; }
+    void boolean(bool value) override { log += value ? "T;" : "F;"; }
+    void null() override { log += "N;"; }
+};
+
+void test_json_stream() {
+    std::cout << "Testing streaming JSON parser..." << std::endl;
+
+    std::string json = R"( {"a": [1, -2.5e1, true, false, null, "x\"y"], "caf\u00e9": {"e": [], "o": {}},
+        "pair": "\ud83d\ude00", "lone": "\ud800!", "n": 0} )";
+    std::string expected = "{k:a;[n:1.000000;n:-25.000000;T;F;N;s:x\"y;]k:caf\xc3\xa9;{k:e;[]k:o;{}}"
+                           "k:pair;s:\xf0\x9f\x98\x80;k:lone;s:\xef\xbf\xbd!;k:n;n:0.000000;}";
+
+    RecordingHandler whole;
+    conduit::JsonStreamParser parser(whole);
+    assert(parser.feed(json) && parser.finish());
+    assert(whole.log == expected);
+
+    // Splitting the input anywhere, or feeding a byte at a time, changes nothing
+    for (size_t split = 0; split <= json.size(); ++split) {
+        RecordingHandler handler;
+        conduit::JsonStreamParser split_parser(handler);
+        assert(split_parser.feed(json.data(), split));
+        assert(split_parser.feed(json.data() + split, json.size() - split));
+        assert(split_parser.finish());
+        assert(handler.log == expected);
+    }
+    RecordingHandler bytes;
+    conduit::JsonStreamParser byte_parser(bytes);
+    for (char c : json) {
+        assert(byte_parser.feed(&c, 1));
+    }
+    assert(byte_parser.finish() && bytes.log == expected);
+
+    // A plain string inside one chunk is handed over without a copy
+    std::string chunk = R"(["plain"])";
+    RecordingHandler direct;
+    conduit::JsonStreamParser direct_parser(direct);
+    direct_parser.feed(chunk);
+    assert(direct.last_string == chunk.data() + 2);
+
+    // Top-level scalars end at end of input; reset() starts a new document
+    RecordingHandler scalar;
+    conduit::JsonStreamParser scalar_parser(scalar);
+    assert(scalar_parser.feed("12") && scalar_parser.feed("34") && scalar_parser.finish());
+    scalar_parser.reset();
+    assert(scalar_parser.feed("\"again\"") && scalar_parser.finish());
+    assert(scalar.log == "n:1234.000000;s:again;");
+
+    for (const char* bad : {"[1,]", "{\"a\" 1}", "[1 2]", "01", "[tru]", "\"\\x\"", "\"a\tb\"", "[}", "{} {}", "-"}) {
+        RecordingHandler handler;
+        conduit::JsonStreamParser bad_parser(handler);
+        assert(!(bad_parser.feed(bad, std::strlen(bad)) && bad_parser.finish()));
+        assert(bad_parser.failed());
+    }
+    RecordingHandler open;
+    conduit::JsonStreamParser open_parser(open);
+    assert(open_parser.feed("[1, {\"a\": ") && open_parser.depth() == 2 && !open_parser.finish());
+
+    RecordingHandler deep;
+    conduit::JsonStreamParser deep_parser(deep);
+    std::string nested(conduit::JsonStreamParser::MAX_DEPTH + 1, '[');
+    assert(!deep_parser.feed(nested) && deep_parser.offset() == conduit::JsonStreamParser::MAX_DEPTH);
+
+    std::cout << "✓ Streaming JSON parser tests passed" << std::endl;
+}
+
+void test_json_lines() {
+    std::cout << "Testing JSON Lines parser..." << std::endl;
+
+    std::string feed;
+    for (int i = 0; i < 200; ++i) {
+        feed += "{\"id\": " + std::to_string(i) + ", \"msg\": \"line\\n" + std::to_string(i) + "\"}";
+        feed += i % 3 == 0 ? "\r\n" : "\n";
+        if (i % 50 == 0) feed += "\n  \n";
+    }
+    feed += "[\"last\"]";     // no final newline
+
+    // Any chunking yields the same records
+    for (size_t chunk : {size_t(1), size_t(2), size_t(7), size_t(64), size_t(4096)}) {
+        int count = 0;
+        int64_t id_sum = 0;
+        bool saw_last = false;
+        conduit::JsonLinesParser parser([&](const conduit::JsonNode& record) {
+            if (record.is_array()) {
+                saw_last = record[0].as_string() == "last";
+            } else {
+                assert(record.get_string("msg") == "line\n" + std::to_string(*record.get_int("id")));
+                id_sum += *record.get_int64("id");
+                ++count;
+            }
+            return true;
+        });
+        for (size_t offset = 0; offset < feed.size(); offset += chunk) {
+            assert(parser.feed(feed.data() + offset, std::min(chunk, feed.size() - offset)));
+        }
+        assert(!saw_last);
+        assert(parser.finish() && saw_last);
+        assert(count == 200 && id_sum == 199 * 200 / 2 && parser.records() == 201);
+    }
+
+    // Returning false stops; later input is ignored
+    int seen = 0;
+    conduit::JsonLinesParser stopper([&](const conduit::JsonNode&) { return ++seen < 3; });
+    assert(!stopper.feed(feed) && stopper.stopped() && !stopper.failed());
+    assert(seen == 3 && !stopper.feed("{}\n") && seen == 3 && stopper.finish());
+
+    // Malformed and overlong lines fail, reporting the line
+    conduit::JsonLinesParser strict([](const conduit::JsonNode&) { return true; }, 64);
+    assert(strict.feed("{\"a\": 1}\n\n{\"b\": 2}\n"));
+    assert(!strict.feed("{\"c\": }\n") && strict.failed() && strict.line() == 4);
+    strict.reset();
+    assert(strict.feed("{\"a\": \"") && !strict.feed(std::string(100, 'x')) && strict.failed());
+    strict.reset();
+    assert(strict.feed("[1, 2") && !strict.finish() && strict.records() == 0);
+
+    std::cout << "✓ JSON Lines parser tests passed" << std::endl;
+}
+
+void test_json_numbers() {
+    std::cout << "Testing JSON number precision..." << std::endl;
+
+    // Integers keep every digit, including beyond 2^53
+    auto parsed = conduit::parse_json(R"({"big": 9007199254740993, "min": -9223372036854775808,
+        "max": 9223372036854775807, "over": 9223372036854775808, "neg_zero": -0, "frac": 0.1})");
+    assert(parsed);
+    auto big = parsed->as_object()->at("big");
+    assert(big->is_integer() && big->as_int64() == 9007199254740993LL);
+    assert(parsed->get_int64("min") == std::numeric_limits<int64_t>::min());
+    assert(parsed->get_int64("max") == std::numeric_limits<int64_t>::max());
+    assert(!parsed->as_object()->at("over")->is_integer());
+    assert(std::signbit(parsed->get_number("neg_zero").value()));
+    assert(!parsed->as_object()->at("frac")->is_integer());
+
+    auto doc = conduit::JsonDocument::parse("[9007199254740993, 2.5]");
+    assert(doc->root()[0].is_integer() && doc->root()[0].as_int64() == 9007199254740993LL);
+    assert(!doc->root()[1].is_integer() && doc->root()[1].as_number() == 2.5);
+    assert(conduit::JsonView("[1, 9007199254740993]")[1].as_int64() == 9007199254740993LL);
+
+    // Doubles past the int64_t range have no integer value; plain accessors clamp
+    const char* huge = R"({"big": 1e30, "small": -1e30, "inf": 1e400, "edge": 9223372036854775808, "ok": 2.5e3})";
+    auto value = conduit::parse_json(huge);
+    assert(!value->get_int64("big") && !value->get_int("small") && !value->get_int64("inf"));
+    assert(!value->get_int64("edge") && value->get_int64("ok") == 2500);
+    assert(value->as_object()->at("big")->as_int64() == std::numeric_limits<int64_t>::max());
+    assert(value->as_object()->at("small")->as_int64() == std::numeric_limits<int64_t>::min());
+    auto huge_doc = conduit::JsonDocument::parse(huge);
+    assert(!huge_doc->root().get_int64("big") && !huge_doc->root().get_int("inf"));
+    assert(huge_doc->root().get_int64("ok") == 2500);
+    assert(huge_doc->root().find("small")->as_int64() == std::numeric_limits<int64_t>::min());
+    assert(huge_doc->root().find("inf")->as_int64() == std::numeric_limits<int64_t>::max());
+    conduit::JsonView huge_view(huge);
+    assert(!huge_view["big"].as_int64() && !huge_view["inf"].as_int() && !huge_view["edge"].as_int64());
+    assert(huge_view["ok"].as_int64() == 2500);
+    assert(conduit::detail::saturate_int64(std::numeric_limits<double>::quiet_NaN()) == 0);
+
+    // Serialization is exact for integers and shortest round-trip for doubles
+    std::string out = conduit::serialize_json(*parsed);
+    assert(out.find("9007199254740993") != std::string::npos);
+    assert(out.find("9223372036854775807") != std::string::npos);
+    assert(out.find("\"frac\":0.1") != std::string::npos);
+    assert(out.find("\"neg_zero\":-0") != std::string::npos);
+    assert(conduit::serialize_json(conduit::JsonValue(int64_t{-42})) == "-42");
+    assert(conduit::serialize_json(conduit::JsonValue(1e300)) == "1e+300");
+    assert(conduit::serialize_json(conduit::JsonValue(std::numeric_limits<double>::infinity())) == "null");
+
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+        std::string text = conduit::serialize_json(conduit::JsonValue(value));
+        auto back = conduit::parse_json(text);
+        assert(back && back->as_number() == value);
+    }
+
+    // Streaming handlers see integers exactly if they ask for them
+    struct Integers : conduit::JsonHandler {
+        std::vector<int64_t> integers;
+        std::vector<double> numbers;
+        void integer(int64_t value) override { integers.push_back(value); }
+        void number(double value) override { numbers.push_back(value); }
+    } integers;
+    conduit::JsonStreamParser stream(integers);
+    assert(stream.feed("[9007199254740993, 1.5]") && stream.finish());
+    assert(integers.integers == std::vector<int64_t>{9007199254740993LL});
+    assert(integers.numbers == std::vector<double>{1.5});
+
+    // Out-of-range exponents saturate rather than fail
+    auto extremes = conduit::parse_json("[1e400, -1e400, 1e-400, 5e-324]");
+    assert(extremes);
+    auto extreme_values = extremes->as_array();
+    assert(std::isinf(extreme_values->at(0)->as_number()) && extreme_values->at(1)->as_number() < 0);
+    assert(extreme_values->at(2)->as_number() == 0.0);
+    assert(extreme_values->at(3)->as_number() == 5e-324);
+
+    std::cout << "✓ JSON number precision tests passed" << std::endl;
+}
+
+void test_json_writer() {
+    std::cout << "Testing JSON writer..." << std::endl;
+
+    std::string out = "prefix:";
+    conduit::JsonWriter writer(out);
+    writer.begin_object().key("id").integer(42).key("ratio").number(0.25).key("tags").begin_array();
+    writer.string("a").boolean(true).null().begin_object().end_object().begin_array().end_array();
+    writer.end_array().key("q\"k").string("line\nbreak\x01\x1f\\").end_object();
+    assert(out == R"(prefix:{"id":42,"ratio":0.25,"tags":["a",true,null,{},[]],"q\"k":"line\nbreak\u0001\u001f\\"})");
+
+    // Escapes land correctly wherever they fall relative to the 16-byte scan
+    for (size_t length = 0; length < 70; ++length) {
+        for (size_t position = 0; position < length; position += 7) {
+            for (char special : {'"', '\\', '\x02', '\t'}) {
+                std::string text(length, 'x');
+                text[position] = special;
+                std::string json;
+                conduit::JsonWriter(json).string(text);
+                auto back = conduit::JsonDocument::parse(json);
+                assert(back && back->root().as_string() == text);
+            }
+        }
+    }
+
+    // serialize_json goes through the writer and keeps the input's key order
+    auto value = conduit::parse_json(R"({"b": [1, 2.5, "s"], "a": {"n": null}})");
+    assert(conduit::serialize_json(*value) == R"({"b":[1,2.5,"s"],"a":{"n":null}})");
+
+    std::cout << "✓ JSON writer tests passed" << std::endl;
+}
+
+namespace bound {
+    struct Address {
+        std::string city;
+        int zip = 0;
+    };
+    CONDUIT_JSON_FIELDS(Address, city, zip);
+
+    struct User {
+        int64_t id = 0;
+        std::string name;
+        bool active = false;
+        double score = 0;
+        std::optional<std::string> email;
+        std::vector<Address> addresses;
+        std::map<std::string, int> counts;
+    };
+    CONDUIT_JSON_FIELDS(User, id, name, active, score, email, addresses, counts);
+} // namespace bound
+
+void test_json_object() {
+    std::cout << "Testing flat JSON objects..." << std::endl;
+
+    // Insertion order is kept, both below and past the indexing threshold
+    for (size_t count : {size_t(3), conduit::JsonObject::INDEX_THRESHOLD + 1, size_t(500)}) {
+        conduit::JsonObject object;
+        for (size_t i = count; i-- > 0;) {
+            object["k" + std::to_string(i)] = std::make_shared<conduit::JsonValue>(static_cast<int64_t>(i));
+        }
+        assert(object.size() == count);
+        assert(object.begin()->first == "k" + std::to_string(count - 1));
+        for (size_t i = 0; i < count; ++i) {
+            assert(object.at("k" + std::to_string(i))->as_int64() == static_cast<int64_t>(i));
+        }
+        assert(object.find("missing") == object.end() && !object.contains("k"));
+
+        assert(!object.emplace("k0", nullptr).second);
+        assert(object.insert_or_assign("k0", std::make_shared<conduit::JsonValue>("zero")).first->second->is_string());
+        assert(object.erase("k1") == 1 && object.erase("k1") == 0);
+        assert(object.size() == count - 1 && !object.contains("k1"));
+        for (size_t i = 2; i < count; ++i) {
+            assert(object.contains("k" + std::to_string(i)));
+        }
+        assert((--object.end())->first == "k0");
+    }
+
+    bool threw = false;
+    try {
+        conduit::JsonObject().at("x");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Repeated names share one interned copy; long names are owned
+    conduit::JsonKey a(std::string("repeated_field"));
+    conduit::JsonKey b(std::string("repeated_field"));
+    assert(a.interned() && a.view().data() == b.view().data() && a == b);
+    conduit::JsonKey long_key(std::string(conduit::JsonKey::MAX_INTERNED_LENGTH + 1, 'x'));
+    assert(!long_key.interned() && long_key.view().size() == conduit::JsonKey::MAX_INTERNED_LENGTH + 1);
+    conduit::JsonKey copy = long_key;
+    assert(copy == long_key && copy.view().data() == long_key.view().data());
+
+    // Parsed objects: first position, last value for repeated keys
+    auto parsed = conduit::parse_json(R"({"z": 1, "a": 2, "z": 3, "m": {"y": 1, "x": 2}})");
+    auto object = parsed->as_object();
+    assert(object->size() == 3 && object->begin()->first == "z" && *parsed->get_int("z") == 3);
+    assert(conduit::serialize_json(*parsed) == R"({"z":3,"a":2,"m":{"y":1,"x":2}})");
+
+    std::cout << "✓ Flat JSON object tests passed" << std::endl;
+}
+
+void test_json_binding() {
+    std::cout << "Testing JSON struct binding..." << std::endl;
+
+    // Keys in any order, unknown keys skipped, absent members left alone
+    auto user = conduit::from_json<bound::User>(R"( {
+        "name": "Ada \"L\"", "extra": {"deep": [1, {"x": "}"}]}, "id": 9007199254740993,
+        "addresses": [{"zip": 12345, "city": "Zürich"}, {"city": "Oslo"}],
+        "email": null, "active": true, "counts": {"a": 1, "b": 2}, "ignored": [] } )");
+    assert(user);
+    assert(user->id == 9007199254740993LL);
+    assert(user->name == "Ada \"L\"");
+    assert(user->active && user->score == 0 && !user->email);
+    assert(user->addresses.size() == 2);
+    assert(user->addresses[0].city == "Z\xc3\xbcrich" && user->addresses[0].zip == 12345);
+    assert(user->addresses[1].city == "Oslo" && user->addresses[1].zip == 0);
+    assert(user->counts.size() == 2 && user->counts.at("b") == 2);
+
+    // Escaped keys still match their members
+    auto escaped = conduit::from_json<bound::Address>(R"({"c\u0069ty": "Rome", "zip": 1e3})");
+    assert(escaped && escaped->city == "Rome" && escaped->zip == 1000);
+
+    // Writing reads the members in declaration order
+    user->email = "ada@example.com";
+    user->score = 0.5;
+    std::string json = conduit::to_json(*user);
+    assert(json.compare(0, 60, R"({"id":9007199254740993,"name":"Ada \"L\"","active":true,"sco)") == 0);
+    auto again = conduit::from_json<bound::User>(json);
+    assert(again && conduit::to_json(*again) == json);
+    assert(conduit::parse_json(json)->get_string("email") == "ada@example.com");
+
+    // Type mismatches, out of range values and malformed text are rejected
+    const char* invalid[] = {
+        R"({"city": 5})", R"({"zip": "5"})", R"({"zip": 1.5})", R"({"zip": 3000000000})",
+        R"({"city": "a",})", R"({"city": "a" "zip": 1})", R"({"city": "a"} x)", R"({"city": "a")",
+        R"([])", R"({"zip": })", "",
+    };
+    for (const char* text : invalid) {
+        assert(!conduit::from_json<bound::Address>(text));
+    }
+    assert(!conduit::from_json<std::vector<int>>("[1,,2]"));
+    assert(!conduit::from_json<uint8_t>("-1"));
+    assert(conduit::from_json<std::vector<int>>(" [ ] ")->empty());
+
+    // Unsigned values above INT64_MAX keep their value both ways
+    std::vector<uint64_t> big = {std::numeric_limits<uint64_t>::max(), 9223372036854775808ull, 0};
+    std::string big_json = conduit::to_json(big);
+    assert(big_json == "[18446744073709551615,9223372036854775808,0]");
+    assert(conduit::from_json<std::vector<uint64_t>>(big_json) == big);
+    assert(conduit::from_json<uint64_t>("1e3") == 1000u);
+    assert(!conduit::from_json<uint64_t>("18446744073709551616"));
+    assert(!conduit::from_json<uint64_t>("-1"));
+    assert(!conduit::from_json<uint32_t>("4294967296"));
+
+    // Response::as reads the body the same way
+    conduit::Response response(200, R"({"city": "Kyiv", "zip": 1001})", {{"Content-Type", "application/json"}});
+    assert(response.as<bound::Address>().city == "Kyiv");
+    bool threw = false;
+    try {
+        response.as<std::vector<bound::Address>>();
+    } catch (const conduit::ResponseException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✓ JSON struct binding tests passed" << std::endl;
+}
+
 void test_url_parsing() {
     std::cout << "Testing URL parsing..." << std::endl;
     
@@ -70,9 +694,159 @@ void test_url_parsing() {
     auto parsed2 = conduit::parse_url("http://example.com/path");
     assert(parsed2.port == 80);
     
+    // Authority forms the old pattern could not take apart
+    auto full = conduit::parse_url("HTTPS://user:p%40ss@[2001:db8::1]:8443/a%20b/c?x=1&y=?#frag");
+    assert(full.scheme == "https");
+    assert(full.userinfo == "user:p%40ss");
+    assert(full.host == "2001:db8::1");
+    assert(full.port == 8443);
+    assert(full.path == "/a%20b/c");
+    assert(full.query == "x=1&y=?");
+    assert(full.fragment == "frag");
+
+    auto bare = conduit::parse_url("https://example.com");
+    assert(bare.port == 443 && bare.path == "/" && bare.query.empty());
+    auto fragment_only = conduit::parse_url("http://example.com:/p#a?b");
+    assert(fragment_only.port == 80 && fragment_only.path == "/p");
+    assert(fragment_only.query.empty() && fragment_only.fragment == "a?b");
+    assert(conduit::parse_url("http://[fe80::1%25eth0]/").host == "fe80::1%eth0");
+    assert(conduit::parse_url("http://ex%61mple.com/").host == "example.com");
+
+    // Cached authorities give the same answers
+    for (int i = 0; i < 3; ++i) {
+        auto again = conduit::parse_url("http://example.com:8080/other?q=" + std::to_string(i));
+        assert(again.host == "example.com" && again.port == 8080);
+        assert(again.path == "/other" && again.query == "q=" + std::to_string(i));
+    }
+
+    for (const char* bad : {"example.com/path", "ftp://example.com/", "http://", "http://:80/",
+                            "http://host:0/", "http://host:65536/", "http://host:8x/", "http://[::1/",
+                            "http://[zz::1]/", "http://ho st/", "http://host/a b", "http://host/%zz",
+                            "http://host/p?q=%4", "http://host/\r\nX-Evil: 1",
+                            "http://a%0D%0AX-Injected%3A%20yes/p", "http://good.example%00.evil.test/",
+                            "http://[fe80::1%25eth0%0A]/", "http://host%40evil.test/"}) {
+        bool threw = false;
+        try {
+            conduit::parse_url(bad);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    // The view parser: no copies, nothing decoded, any scheme
+    auto view = conduit::parse_url_view("ws://h:9/p?q#f");
+    assert(view && view->scheme == "ws" && view->host == "h" && view->port == 9);
+    assert(view->path == "/p" && view->query == "q" && view->fragment == "f");
+    assert(conduit::parse_url_view("ws://h/")->port == -1);
+    assert(conduit::parse_url_view("http://[::1]")->host == "[::1]");
+    assert(!conduit::parse_url_view("http://h/%"));
+
+    assert(conduit::percent_decode("a%20b%2Fc") == "a b/c");
+    assert(conduit::percent_decode("100%") == "100%");
+    assert(conduit::percent_decode("%zz") == "%zz");
+    
     std::cout << "✓ URL parsing tests passed" << std::endl;
 }
 
+void test_header_map() {
+    std::cout << "Testing HeaderMap..." << std::endl;
+
+    conduit::HeaderMap headers{{"Content-Type", "text/html"}, {"Set-Cookie", "a=1"}, {"set-cookie", "b=2"}};
+    assert(headers.size() == 3 && !headers.empty());
+    assert(headers.block() == "Content-Type: text/html\r\nSet-Cookie: a=1\r\nset-cookie: b=2\r\n");
+
+    // Case never matters; repeats are all kept, and get() sees the last
+    assert(headers.get("content-type") == "text/html");
+    assert(headers.get(conduit::header::content_type) == "text/html");
+    assert(headers.get(std::string("CONTENT-TYPE")) == "text/html");
+    assert(headers.count(conduit::header::set_cookie) == 2);
+    assert(headers.get("Set-Cookie") == "b=2");
+    assert((headers.get_all("SET-COOKIE") == std::vector<std::string_view>{"a=1", "b=2"}));
+    assert(!headers.get("Content-Typ") && !headers.contains("Location"));
+    static_assert(conduit::header::content_type.hash == conduit::detail::header_hash("content-type"));
+
+    std::vector<std::string> names;
+    for (const auto& [name, value] : headers) {
+        names.push_back(std::string(name) + "=" + std::string(value));
+    }
+    assert((names == std::vector<std::string>{"Content-Type=text/html", "Set-Cookie=a=1", "set-cookie=b=2"}));
+
+    // Past the inline entries, through copies and moves
+    conduit::HeaderMap many;
+    for (int i = 0; i < 40; ++i) {
+        many.add("X-Field-" + std::to_string(i), std::to_string(i * i));
+    }
+    conduit::HeaderMap copy = many;
+    conduit::HeaderMap moved = std::move(many);
+    assert(many.empty() && many.block().empty());
+    for (const auto* map : {&copy, &moved}) {
+        assert(map->size() == 40);
+        assert(map->get("x-field-3") == "9" && map->get("X-FIELD-39") == "1521");
+    }
+    conduit::HeaderMap small{{"A", "1"}};
+    conduit::HeaderMap small_moved = std::move(small);
+    assert(small_moved.get("a") == "1" && small.size() == 0);
+
+    std::map<std::string, std::string> legacy = {{"B", "2"}, {"A", "1"}};
+    conduit::HeaderMap converted(legacy);
+    assert(converted.block() == "A: 1\r\nB: 2\r\n");
+    converted.clear();
+    assert(converted.empty() && !converted.get("A"));
+
+    conduit::Response response(200, "", {{"content-type", "application/json; charset=utf-8"}});
+    assert(response.get_header("Content-Type") == "application/json; charset=utf-8");
+    assert(response.content_type() == "application/json; charset=utf-8");
+    assert(!response.get_header("Location"));
+
+    std::cout << "✓ HeaderMap tests passed" << std::endl;
+}
+
+void test_url_encoding() {
+    std::cout << "Testing query and form encoding..." << std::endl;
+
+    assert(conduit::percent_encode("AZaz09-._~") == "AZaz09-._~");
+    assert(conduit::percent_encode("a b&c=d/\xc3\xa9*") == "a%20b%26c%3Dd%2F%C3%A9%2A");
+    assert(conduit::percent_encode("") == "");
+    assert(conduit::percent_decode(conduit::percent_encode(std::string("\0\x7f\xff%+", 5))) ==
+           std::string("\0\x7f\xff%+", 5));
+
+    conduit::QueryBuilder url("https://api.example.com/search");
+    url.add("q", "rock & roll").add("limit", 50).add("offset", int64_t{-1}).add("empty", "");
+    assert(url.str() == "https://api.example.com/search?q=rock%20%26%20roll&limit=50&offset=-1&empty=");
+    auto parsed = conduit::parse_url(url.str());
+    assert(parsed.path == "/search" && parsed.query == "q=rock%20%26%20roll&limit=50&offset=-1&empty=");
+
+    // Reused: the base stays, the parameters go, the capacity is kept
+    const char* data = url.str().data();
+    url.clear();
+    assert(url.str() == "https://api.example.com/search");
+    url.add("q", "x");
+    assert(url.str() == "https://api.example.com/search?q=x" && url.str().data() == data);
+
+    assert(conduit::QueryBuilder("/p?a=1").add("b", "2").str() == "/p?a=1&b=2");
+    assert(conduit::QueryBuilder("/p?").add("b", "2").str() == "/p?b=2");
+    assert(conduit::QueryBuilder("/p?a=1&").add("b", "2").str() == "/p?a=1&b=2");
+    assert(conduit::QueryBuilder().add("k y", "v").add("n", 1).str() == "k%20y=v&n=1");
+
+    conduit::QueryBuilder many("/batch");
+    std::string expected = "/batch";
+    for (int i = 0; i < 40; ++i) {
+        many.add("id[]", i);
+        expected += (i == 0 ? "?" : "&") + std::string("id%5B%5D=") + std::to_string(i);
+    }
+    assert(many.str() == expected);
+
+    conduit::FormBody form;
+    form.add("name", "Ada Lovelace").add("note", "1+1=2 & *stars*~").add("age", 36);
+    assert(form.str() == "name=Ada+Lovelace&note=1%2B1%3D2+%26+*stars*%7E&age=36");
+    form.clear();
+    assert(form.str().empty());
+    assert(std::string(conduit::FormBody::CONTENT_TYPE) == "application/x-www-form-urlencoded");
+
+    std::cout << "✓ Query and form encoding tests passed" << std::endl;
+}
+
 void test_json_value_creation() {
     std::cout << "Testing JsonValue creation..." << std::endl;
     
@@ -103,7 +877,18 @@ int main() {
         test_json_value_creation();
         test_json_parsing();
         test_json_serialization();
+        test_json_document();
+        test_structural_index();
+        test_json_view();
+        test_json_stream();
+        test_json_lines();
+        test_json_numbers();
+        test_json_writer();
+        test_json_object();
+        test_json_binding();
         test_url_parsing();
+        test_url_encoding();
+        test_header_map();
         
         std::cout << std::endl;
         std::cout << "🎉 All tests passed!" << std::endl;
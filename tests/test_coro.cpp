@@ -0,0 +1,155 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/conduit.hpp"
+#include "../include/conduit_coro.hpp"
+#include "test_server.hpp"
+
+conduit::Task<std::string> fetch_body(conduit::AsyncClient& client, std::string url) {
+    auto response = co_await conduit::async_get(client, url);
+    co_return response.body();
+}
+
+conduit::Task<int> fetch_sequence(conduit::AsyncClient& client, std::string base, int count) {
+    int total = 0;
+    for (int i = 0; i < count; ++i) {
+        std::string body = co_await fetch_body(client, base + "/" + std::to_string(i));
+        assert(body == "/" + std::to_string(i));
+        ++total;
+    }
+
+    auto object = std::make_shared<std::map<std::string, std::shared_ptr<conduit::JsonValue>>>();
+    (*object)["total"] = std::make_shared<conduit::JsonValue>(static_cast<double>(total));
+    conduit::JsonValue json;
+    json.set_object(object);
+    auto echoed = co_await conduit::async_post_json(client, base + "/echo", json);
+    co_return *echoed.json()->get_int("total");
+}
+
+std::string path_of(const std::string& request) {
+    size_t start = request.find(' ') + 1;
+    return request.substr(start, request.find(' ', start) - start);
+}
+
+void test_coroutine_requests() {
+    std::cout << "Testing awaitable requests..." << std::endl;
+
+    TestServer server([](const std::string& request) {
+        if (path_of(request) == "/echo") {
+            return ok_response(request.substr(request.find("\r\n\r\n") + 4), "Content-Type: application/json\r\n");
+        }
+        return ok_response(path_of(request));
+    });
+    std::string base = "http://127.0.0.1:" + std::to_string(server.port());
+
+    conduit::EventLoop loop;
+    conduit::AsyncClient client(loop);
+
+    // Sequential awaits reuse one keep-alive connection
+    assert(conduit::sync_wait(loop, fetch_sequence(client, base, 10)) == 10);
+    assert(server.accepted() == 1);
+
+    // Many coroutines in flight on one thread
+    int finished = 0;
+    for (int i = 0; i < 20; ++i) {
+        conduit::spawn(loop, [](conduit::AsyncClient& client, std::string url, int& finished) -> conduit::Task<> {
+            std::string body = co_await fetch_body(client, url);
+            assert(body == "/spawned");
+            ++finished;
+        }(client, base + "/spawned", finished));
+    }
+    loop.run();
+    assert(finished == 20);
+
+    // Errors are thrown from co_await
+    bool threw = false;
+    try {
+        conduit::sync_wait(loop, fetch_body(client, "http://host.invalid/"));
+    } catch (const conduit::ConnectionException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✓ Awaitable request tests passed" << std::endl;
+}
+
+void test_coroutine_timeout_and_cancel() {
+    std::cout << "Testing request deadlines and cancellation..." << std::endl;
+
+    TestServer server([](const std::string& request) {
+        if (path_of(request) == "/slow") {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+        }
+        return ok_response("late");
+    });
+    std::string base = "http://127.0.0.1:" + std::to_string(server.port());
+
+    conduit::EventLoop loop;
+    conduit::ClientConfig config;
+    config.timeout = std::chrono::seconds(1);
+    conduit::AsyncClient client(loop, config);
+
+    auto start = std::chrono::steady_clock::now();
+    bool timed_out = false;
+    try {
+        conduit::sync_wait(loop, fetch_body(client, base + "/slow"));
+    } catch (const conduit::TimeoutException&) {
+        timed_out = true;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(timed_out);
+    assert(elapsed >= std::chrono::milliseconds(990) && elapsed < std::chrono::milliseconds(1400));
+    assert(client.in_flight() == 0);
+
+    // Cancel from a sibling coroutine after a short sleep
+    conduit::CancellationToken token;
+    conduit::spawn(loop, [](conduit::EventLoop& loop, conduit::CancellationToken token) -> conduit::Task<> {
+        co_await conduit::sleep_for(loop, std::chrono::milliseconds(50));
+        token.cancel();
+    }(loop, token));
+
+    start = std::chrono::steady_clock::now();
+    bool cancelled = false;
+    try {
+        conduit::sync_wait(loop, conduit::async_get(client, base + "/slow", {}, token));
+    } catch (const conduit::CancelledException&) {
+        cancelled = true;
+    }
+    assert(cancelled);
+    assert(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(900));
+
+    // A cancelled token fails later requests before they are sent
+    int requests = server.requests();
+    cancelled = false;
+    try {
+        conduit::sync_wait(loop, conduit::async_get(client, base + "/fast", {}, token));
+    } catch (const conduit::CancelledException&) {
+        cancelled = true;
+    }
+    assert(cancelled);
+    assert(server.requests() == requests);
+
+    std::cout << "✓ Deadline and cancellation tests passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Conduit C++ Coroutine Tests" << std::endl;
+    std::cout << "===================================" << std::endl;
+
+    try {
+        test_coroutine_requests();
+        test_coroutine_timeout_and_cancel();
+
+        std::cout << std::endl;
+        std::cout << "🎉 All tests passed!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,1368 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <functional>
+#include <sstream>
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "../include/conduit.hpp"
+#include "../include/conduit_async.hpp"
+#include "http_parser.hpp"
+#include "http_request.hpp"
+#include "timer_wheel.hpp"
+#include "resolver.hpp"
+#include "test_server.hpp"
+
+void test_pool_reuses_connections() {
+    std::cout << "Testing keep-alive connection reuse..." << std::endl;
+
+    TestServer server([](const std::string&) { return ok_response("pong"); });
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/ping";
+
+    conduit::HttpClient client;
+    for (int i = 0; i < 5; ++i) {
+        auto response = client.get(url);
+        assert(response.status_code() == 200);
+        assert(response.body() == "pong");
+    }
+    auto post_response = client.post(url, "data", "text/plain");
+    assert(post_response.body() == "pong");
+
+    assert(server.requests() == 6);
+    assert(server.accepted() == 1);
+    assert(client.idle_connections() == 1);
+
+    client.clear_idle_connections();
+    assert(client.idle_connections() == 0);
+
+    std::cout << "✓ Keep-alive connection reuse tests passed" << std::endl;
+}
+
+void test_pool_honours_connection_close() {
+    std::cout << "Testing Connection: close handling..." << std::endl;
+
+    TestServer server([](const std::string&) {
+        return ok_response("bye", "Connection: close\r\n");
+    });
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/";
+
+    conduit::HttpClient client;
+    for (int i = 0; i < 3; ++i) {
+        assert(client.get(url).body() == "bye");
+        assert(client.idle_connections() == 0);
+    }
+    assert(server.accepted() == 3);
+
+    std::cout << "✓ Connection: close handling tests passed" << std::endl;
+}
+
+void test_pool_drops_stale_connections() {
+    std::cout << "Testing stale connection detection..." << std::endl;
+
+    // Close the socket after every reply without announcing it, as servers
+    // with a short keep-alive timeout do.
+    TestServer server([](const std::string&) { return ok_response("once"); }, true);
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/";
+
+    conduit::HttpClient client;
+    assert(client.get(url).body() == "once");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    assert(client.get(url).body() == "once");
+    assert(server.accepted() == 2);
+
+    // Racing the server's FIN: the reused socket fails and is retried
+    assert(client.get(url).body() == "once");
+    assert(server.accepted() == 3);
+
+    std::cout << "✓ Stale connection detection tests passed" << std::endl;
+}
+
+void test_pool_does_not_resend_post() {
+    std::cout << "Testing that a dropped POST is not resent..." << std::endl;
+
+    // The server reads the POST, then closes without replying
+    TestServer server([](const std::string& request) {
+        return request.compare(0, 5, "POST ") == 0 ? std::string() : ok_response("ok");
+    });
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/";
+
+    conduit::HttpClient client;
+    assert(client.get(url).body() == "ok");
+    assert(client.idle_connections() == 1);
+
+    bool failed = false;
+    try {
+        client.post(url, "charge=1", "application/x-www-form-urlencoded");
+    } catch (const conduit::ConnectionException&) {
+        failed = true;
+    }
+    assert(failed);
+    assert(server.requests() == 2);
+    assert(server.accepted() == 1);
+
+    std::cout << "✓ Dropped POST tests passed" << std::endl;
+}
+
+void test_chunked_keep_alive() {
+    std::cout << "Testing chunked responses on a persistent connection..." << std::endl;
+
+    TestServer server([](const std::string& request) {
+        if (request.find("/empty") != std::string::npos) {
+            return std::string("HTTP/1.1 204 No Content\r\n\r\n");
+        }
+        return std::string("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+                           "4\r\nWiki\r\n5\r\npedia\r\n0\r\n\r\n");
+    });
+
+    // The server never closes, so any framing mistake would hang here
+    conduit::HttpClient client;
+    auto conn = client.connect("127.0.0.1", server.port());
+    for (int i = 0; i < 3; ++i) {
+        assert(conn.get("/wiki").body() == "Wikipedia");
+        assert(conn.get("/empty").status_code() == 204);
+    }
+
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/wiki";
+    assert(client.get(url).body() == "Wikipedia");
+    assert(client.get(url).body() == "Wikipedia");
+    assert(server.accepted() == 2);
+    assert(client.idle_connections() == 1);
+
+    std::cout << "✓ Chunked persistent connection tests passed" << std::endl;
+}
+
+void test_streaming_body() {
+    std::cout << "Testing streamed response bodies..." << std::endl;
+
+    std::string payload;
+    for (int i = 0; i < 20000; ++i) {
+        payload += "line " + std::to_string(i) + "\n";
+    }
+
+    TestServer server([&](const std::string& request) {
+        if (request.find("/chunked") != std::string::npos) {
+            std::ostringstream reply;
+            reply << "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+            for (size_t offset = 0; offset < payload.size(); offset += 1000) {
+                std::string piece = payload.substr(offset, 1000);
+                reply << std::hex << piece.size() << "\r\n" << piece << "\r\n";
+            }
+            reply << "0\r\n\r\n";
+            return reply.str();
+        }
+        return ok_response(payload);
+    });
+
+    conduit::HttpClient client;
+    auto conn = client.connect("127.0.0.1", server.port());
+
+    std::string received;
+    int status = 0;
+    size_t pieces = 0;
+    conduit::StreamHandler handler;
+    handler.on_headers = [&](int code, const conduit::HeaderMap& headers) {
+        assert(received.empty());
+        assert(headers.count("transfer-encoding") == 1);
+        status = code;
+    };
+    handler.on_data = [&](const char* data, size_t size) {
+        assert(status == 200);
+        received.append(data, size);
+        ++pieces;
+    };
+
+    auto response = conn.get_stream("/chunked", handler);
+    assert(response.status_code() == 200);
+    assert(response.body().empty());
+    assert(received == payload);
+    assert(pieces > 1);
+
+    // Same connection, plain Content-Length body into an ostream
+    std::ostringstream out;
+    conn.get_stream("/plain", out);
+    assert(out.str() == payload);
+
+    // Aborting from the callback leaves the socket out of the pool
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/plain";
+    conduit::StreamHandler abort_handler;
+    abort_handler.on_data = [](const char*, size_t) { throw std::runtime_error("stop"); };
+    bool threw = false;
+    try {
+        client.get_stream(url, abort_handler);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(client.idle_connections() == 0);
+
+    std::ostringstream pooled;
+    client.get_stream(url, pooled);
+    assert(pooled.str() == payload);
+    assert(client.idle_connections() == 1);
+
+    std::cout << "✓ Streamed response body tests passed" << std::endl;
+}
+
+void test_json_streaming() {
+    std::cout << "Testing streamed JSON bodies..." << std::endl;
+
+    std::string items = "[";
+    for (int i = 0; i < 5000; ++i) {
+        items += (i ? "," : "") + std::string("{\"id\":") + std::to_string(i) + ",\"name\":\"item " +
+                 std::to_string(i) + "\"}";
+    }
+    items += "]";
+
+    TestServer server([&](const std::string& request) {
+        if (request.find("/items") != std::string::npos) {
+            std::ostringstream reply;
+            reply << "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nTransfer-Encoding: chunked\r\n\r\n";
+            for (size_t offset = 0; offset < items.size(); offset += 777) {
+                std::string piece = items.substr(offset, 777);
+                reply << std::hex << piece.size() << "\r\n" << piece << "\r\n";
+            }
+            reply << "0\r\n\r\n";
+            return reply.str();
+        }
+        if (request.find("/broken") != std::string::npos) {
+            return ok_response("[1, 2", "Content-Type: application/json\r\n");
+        }
+        return ok_response("not json");
+    });
+
+    // Sums ids one element at a time, keeping no DOM
+    struct Summer : conduit::JsonHandler {
+        int depth = 0;
+        int elements = 0;
+        bool id_next = false;
+        double id_sum = 0;
+        void start_object() override { ++depth; }
+        void end_object() override {
+            if (--depth == 0) ++elements;
+        }
+        void key(std::string_view name) override { id_next = name == "id"; }
+        void number(double value) override {
+            if (id_next) id_sum += value;
+        }
+    };
+
+    conduit::HttpClient client;
+    auto conn = client.connect("127.0.0.1", server.port());
+    Summer summer;
+    auto response = conn.get_stream("/items", summer);
+    assert(response.status_code() == 200 && response.body().empty());
+    assert(summer.elements == 5000);
+    assert(summer.id_sum == 4999.0 * 5000 / 2);
+
+    // Non-JSON bodies are skipped; malformed ones throw
+    Summer skipped;
+    conn.get_stream("/text", skipped);
+    assert(skipped.elements == 0);
+
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/broken";
+    bool threw = false;
+    try {
+        client.get_stream(url, skipped);
+    } catch (const conduit::ResponseException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✓ Streamed JSON body tests passed" << std::endl;
+}
+
+struct Item {
+    int64_t id = 0;
+    std::vector<std::string> tags;
+};
+CONDUIT_JSON_FIELDS(Item, id, tags);
+
+void test_json_lines_streaming() {
+    std::cout << "Testing JSON Lines bodies..." << std::endl;
+
+    std::string lines;
+    for (int i = 0; i < 5000; ++i) {
+        lines += "{\"seq\":" + std::to_string(i) + ",\"event\":\"update\"}\n";
+    }
+    auto chunked = [](const std::string& body) {
+        std::ostringstream reply;
+        reply << "HTTP/1.1 200 OK\r\nContent-Type: application/x-ndjson\r\nTransfer-Encoding: chunked\r\n\r\n";
+        for (size_t offset = 0; offset < body.size(); offset += 777) {
+            std::string piece = body.substr(offset, 777);
+            reply << std::hex << piece.size() << "\r\n" << piece << "\r\n";
+        }
+        reply << "0\r\n\r\n";
+        return reply.str();
+    };
+
+    TestServer server([&](const std::string& request) {
+        if (request.find("/feed") != std::string::npos) {
+            return chunked(lines);
+        }
+        if (request.find("/broken") != std::string::npos) {
+            return chunked("{\"seq\":1}\n{\"seq\":\n");
+        }
+        return ok_response("{\"not\": \"lines\"}\n");
+    });
+
+    conduit::HttpClient client;
+    auto conn = client.connect("127.0.0.1", server.port());
+    int64_t expected = 0;
+    auto response = conn.get_json_lines("/feed", [&](const conduit::JsonNode& record) {
+        assert(record.get_int64("seq") == expected++);
+        return true;
+    });
+    assert(response.status_code() == 200 && expected == 5000 && conn.is_connected());
+
+    // Non-JSON bodies are skipped
+    int records = 0;
+    conn.get_json_lines("/text", [&](const conduit::JsonNode&) { return ++records, true; });
+    assert(records == 0);
+
+    // Stopping early closes the connection instead of draining the feed
+    auto stopped = conn.get_json_lines("/feed", [&](const conduit::JsonNode&) { return ++records < 10; });
+    assert(stopped.status_code() == 200 && records == 10 && !conn.is_connected());
+    assert(stopped.get_header("Content-Type") == "application/x-ndjson");
+
+    std::string base = "http://127.0.0.1:" + std::to_string(server.port());
+    bool threw = false;
+    try {
+        client.get_json_lines(base + "/broken", [](const conduit::JsonNode&) { return true; });
+    } catch (const conduit::ResponseException& e) {
+        threw = std::string(e.what()).find("line 2") != std::string::npos;
+    }
+    assert(threw);
+    assert(client.get(base + "/text").status_code() == 200);
+
+    std::cout << "✓ JSON Lines streaming tests passed" << std::endl;
+}
+
+void test_request_serialization() {
+    std::cout << "Testing request serialization..." << std::endl;
+
+    conduit::HeaderMap defaults = {{"Accept", "*/*"}, {"User-Agent", "Conduit-CPP/1.0"}};
+    const std::string& block = defaults.block();
+    assert(block == "Accept: */*\r\nUser-Agent: Conduit-CPP/1.0\r\n");
+
+    // Defaults and body are referenced, not copied; a default wins over a
+    // request header of the same name in any case
+    std::string body(100000, 'b');
+    conduit::RequestParts parts;
+    conduit::build_http_request("PUT", "/x?y=1", "example.com", defaults,
+                                {{"X-Id", "7"}, {"user-agent", "ignored"}}, {}, body, parts);
+    std::vector<iovec> buffers;
+    parts.gather(buffers);
+    assert(buffers.size() == 4);
+    assert(buffers[1].iov_base == block.data() && buffers[3].iov_base == body.data());
+
+    std::string wire = conduit::build_http_request("PUT", "/x?y=1", "example.com", defaults,
+                                                   {{"X-Id", "7"}, {"user-agent", "ignored"}}, {}, body);
+    assert(wire == "PUT /x?y=1 HTTP/1.1\r\nHost: example.com\r\n" + block +
+                   "X-Id: 7\r\nContent-Length: 100000\r\n\r\n" + body);
+    assert(parts.size() == wire.size());
+
+    // An explicit content type replaces the request's own, and request
+    // headers keep their order and repeats
+    wire = conduit::build_http_request("POST", "/", "h", {}, {{"B", "1"}, {"content-type", "text/plain"}, {"A", "2"},
+                                                             {"B", "3"}}, "application/json", "{}");
+    assert(wire == "POST / HTTP/1.1\r\nHost: h\r\nContent-Type: application/json\r\nB: 1\r\nA: 2\r\nB: 3\r\n"
+                   "Content-Length: 2\r\n\r\n{}");
+
+    buffers.clear();
+    conduit::build_http_request("GET", "/", "h", {}, {}, {}, "", parts);
+    parts.gather(buffers);
+    assert(buffers.size() == 2 && parts.size() == std::string("GET / HTTP/1.1\r\nHost: h\r\n\r\n").size());
+    assert(conduit::build_http_request("GET", "/", "::1", {}, {}, {}, "") ==
+           "GET / HTTP/1.1\r\nHost: [::1]\r\n\r\n");
+
+    // On the wire: defaults rendered once per connection, big bodies intact
+    std::mutex mutex;
+    std::vector<std::string> received;
+    TestServer server([&](const std::string& request) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(request);
+        return ok_response(std::to_string(request.size() - request.find("\r\n\r\n") - 4));
+    });
+    conduit::ClientConfig config;
+    config.default_headers["X-Tenant"] = "acme";
+    conduit::HttpClient client(config);
+    auto conn = client.connect("127.0.0.1", server.port());
+    std::string upload(3 * 1024 * 1024 + 17, 'u');
+    assert(conn.post("/upload", upload, "application/octet-stream").body() == std::to_string(upload.size()));
+    assert(conn.get("/plain", {{"X-Trace", "1"}}).body() == "0");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    assert(received.size() == 2);
+    for (const auto& request : received) {
+        assert(request.find("\r\nUser-Agent: Conduit-CPP/1.0\r\nX-Tenant: acme\r\n") != std::string::npos);
+    }
+    assert(received[0].find("Content-Type: application/octet-stream\r\n") != std::string::npos);
+    assert(received[1].find("X-Trace: 1\r\n") != std::string::npos);
+
+    std::cout << "✓ Request serialization tests passed" << std::endl;
+}
+
+void test_request_templates() {
+    std::cout << "Testing request templates..." << std::endl;
+
+    std::mutex mutex;
+    std::vector<std::string> received;
+    TestServer server([&](const std::string& request) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(request);
+        return ok_response(request.substr(0, request.find(' ', request.find(' ') + 1)));
+    });
+    conduit::ClientConfig config;
+    config.default_headers["X-Tenant"] = "acme";
+    conduit::HttpClient client(config);
+    auto conn = client.connect("127.0.0.1", server.port());
+
+    auto order = conn.prepare("GET", "/users/{user}/orders/{order}?v=2", {{"Accept", "application/json"}});
+    assert(order.method() == "GET");
+    assert((order.slots() == std::vector<std::string>{"user", "order"}));
+    assert(conn.send(order, {"42", "a-7"}).body() == "GET /users/42/orders/a-7?v=2");
+    assert(conn.send(order, {"43", ""}).body() == "GET /users/43/orders/?v=2");
+
+    auto update = conn.prepare("PUT", "/items/{id}", {{"Content-Type", "application/json"}});
+    assert(conn.send(update, {"9"}, R"({"n":1})").body() == "PUT /items/9");
+    auto ping = conn.prepare("GET", "/ping");
+    assert(ping.slots().empty() && conn.send(ping).body() == "GET /ping");
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        assert(received.size() == 4);
+        assert(received[0] == "GET /users/42/orders/a-7?v=2 HTTP/1.1\r\nHost: 127.0.0.1\r\n"
+                              "User-Agent: Conduit-CPP/1.0\r\nX-Tenant: acme\r\nAccept: application/json\r\n\r\n");
+        assert(received[2].find("Content-Type: application/json\r\nContent-Length: 7\r\n\r\n{\"n\":1}") !=
+               std::string::npos);
+    }
+
+    // The same bytes as the untemplated path
+    conn.get("/users/42/orders/a-7?v=2", {{"Accept", "application/json"}});
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        assert(received[4] == received[0]);
+    }
+
+    auto expect_request_error = [](const std::function<void()>& call) {
+        try {
+            call();
+            assert(false && "expected RequestException");
+        } catch (const conduit::RequestException&) {
+        }
+    };
+    expect_request_error([&] { conn.prepare("GET", "/users/{user"); });
+    expect_request_error([&] { conn.prepare("GET", "/users/{}"); });
+    expect_request_error([&] { conn.send(order, {"42"}); });
+    expect_request_error([&] { conn.send(order, {"42", "a 7"}); });
+    expect_request_error([&] { conn.send(order, {"42\r\nX-Evil: 1", "1"}); });
+
+    auto other = client.connect("localhost", server.port());
+    expect_request_error([&] { other.send(order, {"1", "2"}); });
+    assert(conn.send(ping).status_code() == 200);
+
+    std::cout << "✓ Request template tests passed" << std::endl;
+}
+
+void test_query_and_form_requests() {
+    std::cout << "Testing query strings and form bodies..." << std::endl;
+
+    std::mutex mutex;
+    std::vector<std::string> received;
+    TestServer server([&](const std::string& request) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(request);
+        return ok_response("ok");
+    });
+    conduit::HttpClient client;
+    std::string base = "http://127.0.0.1:" + std::to_string(server.port());
+
+    conduit::QueryBuilder search(base + "/search");
+    search.add("q", "a b").add("page", 2);
+    assert(client.get(search.str()).status_code() == 200);
+
+    // The query used to be dropped by post and post_json
+    assert(client.post(base + "/items?dry_run=1#top", "{}").status_code() == 200);
+    assert(client.post_json(base + "/items?v=2", conduit::JsonValue(true)).status_code() == 200);
+
+    conduit::FormBody form;
+    form.add("user", "ada lovelace").add("tags", "x&y");
+    assert(client.post_form(conduit::QueryBuilder(base + "/login").add("next", "/home").str(), form)
+               .status_code() == 200);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    assert(received.size() == 4);
+    assert(received[0].rfind("GET /search?q=a%20b&page=2 HTTP/1.1\r\n", 0) == 0);
+    assert(received[1].rfind("POST /items?dry_run=1 HTTP/1.1\r\n", 0) == 0);
+    assert(received[2].rfind("POST /items?v=2 HTTP/1.1\r\n", 0) == 0);
+    assert(received[3].rfind("POST /login?next=%2Fhome HTTP/1.1\r\n", 0) == 0);
+    assert(received[3].find("Content-Type: application/x-www-form-urlencoded\r\n") != std::string::npos);
+    assert(received[3].substr(received[3].find("\r\n\r\n") + 4) == "user=ada+lovelace&tags=x%26y");
+
+    std::cout << "✓ Query string and form body tests passed" << std::endl;
+}
+
+void test_post_json_body() {
+    std::cout << "Testing post_json uploads..." << std::endl;
+
+    TestServer server([](const std::string& request) {
+        return ok_response(request.substr(request.find("\r\n\r\n") + 4), "Content-Type: application/json\r\n");
+    });
+
+    auto items = std::make_shared<std::vector<std::shared_ptr<conduit::JsonValue>>>();
+    for (int i = 0; i < 20000; ++i) {
+        items->push_back(std::make_shared<conduit::JsonValue>("item \"" + std::to_string(i) + "\"\n"));
+    }
+    conduit::JsonValue upload;
+    upload.set_array(items);
+    std::string expected = conduit::serialize_json(upload);
+    assert(expected.size() > 256 * 1024);
+
+    // Head and body go out as separate buffers; the server sees one request
+    conduit::HttpClient client;
+    auto conn = client.connect("127.0.0.1", server.port());
+    for (int round = 0; round < 2; ++round) {
+        auto response = conn.post_json("/upload", upload);
+        assert(response.body() == expected);
+        assert(response.json()->as_array()->at(19999)->as_string() == "item \"19999\"\n");
+    }
+    assert(conn.post("/small", "{}").body() == "{}");
+
+    // Bound structs are written into the same buffer and read back directly
+    Item item{7, {"a", "b\""}};
+    auto echoed = conn.post_json("/item", item);
+    assert(echoed.body() == R"({"id":7,"tags":["a","b\""]})");
+    assert(echoed.as<Item>().tags.at(1) == "b\"");
+    assert(client.post_json("http://127.0.0.1:" + std::to_string(server.port()) + "/item", item).as<Item>().id == 7);
+    assert(server.requests() == 5);
+
+    std::cout << "✓ post_json upload tests passed" << std::endl;
+}
+
+void test_pipelining() {
+    std::cout << "Testing request pipelining..." << std::endl;
+
+    auto path_of = [](const std::string& request) {
+        size_t start = request.find(' ') + 1;
+        return request.substr(start, request.find(' ', start) - start);
+    };
+    auto batch = [](std::vector<std::string> paths) {
+        std::vector<conduit::PipelinedRequest> requests;
+        for (auto& path : paths) {
+            conduit::PipelinedRequest request;
+            request.path = path;
+            requests.push_back(request);
+        }
+        return requests;
+    };
+
+    TestServer server([&](const std::string& request) {
+        std::string path = path_of(request);
+        if (path == "/stop") {
+            return ok_response(path, "Connection: close\r\n");
+        }
+        if (request.rfind("POST", 0) == 0) {
+            return ok_response(request.substr(request.find("\r\n\r\n") + 4));
+        }
+        std::string reply = ok_response(path);
+        if (request.rfind("HEAD", 0) == 0) {
+            reply.erase(reply.find("\r\n\r\n") + 4);
+        }
+        return reply;
+    });
+
+    conduit::ClientConfig config;
+    config.pipeline_depth = 4;
+    conduit::HttpClient client(config);
+
+    // Responses come back in request order on one socket, across batches
+    std::vector<std::string> paths;
+    for (int i = 0; i < 10; ++i) {
+        paths.push_back("/" + std::to_string(i));
+    }
+    auto requests = batch(paths);
+    requests[3].method = "HEAD";
+    requests[6].method = "POST";
+    requests[6].body = "posted";
+
+    auto conn = client.connect("127.0.0.1", server.port());
+    auto responses = conn.pipeline(requests);
+    assert(responses.size() == 10);
+    for (size_t i = 0; i < responses.size(); ++i) {
+        std::string expected = i == 3 ? "" : i == 6 ? "posted" : paths[i];
+        assert(responses[i].status_code() == 200);
+        assert(responses[i].body() == expected);
+    }
+    assert(server.accepted() == 1);
+    assert(server.requests() == 10);
+
+    // A server closing midway leaves the rest to be resent sequentially
+    responses = conn.pipeline(batch({"/a", "/b", "/stop", "/c", "/d", "/e"}));
+    assert(responses.size() == 6);
+    assert(responses[2].body() == "/stop" && responses[5].body() == "/e");
+    assert(server.accepted() == 2);
+    assert(server.requests() == 16);
+
+    // Servers that close after every reply still get every request answered
+    TestServer closing([&](const std::string& request) { return ok_response(path_of(request)); }, true);
+    auto closing_conn = client.connect("127.0.0.1", closing.port());
+    responses = closing_conn.pipeline(batch({"/1", "/2", "/3", "/4"}));
+    assert(responses.size() == 4);
+    for (size_t i = 0; i < responses.size(); ++i) {
+        assert(responses[i].body() == "/" + std::to_string(i + 1));
+    }
+    assert(closing.accepted() == 4);
+
+    // A POST the server read before dropping the connection is not resent
+    TestServer dropping([&](const std::string& request) {
+        return request.rfind("POST", 0) == 0 ? std::string() : ok_response(path_of(request));
+    });
+    auto dropping_conn = client.connect("127.0.0.1", dropping.port());
+    requests = batch({"/a", "/b", "/charge", "/c"});
+    requests[2].method = "POST";
+    requests[2].body = "amount=1";
+    bool failed = false;
+    try {
+        dropping_conn.pipeline(requests);
+    } catch (const conduit::ConnectionException&) {
+        failed = true;
+    }
+    assert(failed);
+    assert(dropping.requests() == 3);
+    assert(dropping.accepted() == 1);
+
+    std::cout << "✓ Request pipelining tests passed" << std::endl;
+}
+
+void test_pool_limits() {
+    std::cout << "Testing pool limits..." << std::endl;
+
+    TestServer first([](const std::string&) { return ok_response("a"); });
+    TestServer second([](const std::string&) { return ok_response("b"); });
+
+    conduit::ClientConfig config;
+    config.max_idle_connections = 1;
+    conduit::HttpClient client(config);
+
+    client.get("http://127.0.0.1:" + std::to_string(first.port()) + "/");
+    client.get("http://127.0.0.1:" + std::to_string(second.port()) + "/");
+    assert(client.idle_connections() == 1);
+
+    // The first host's socket was evicted to make room for the second
+    client.get("http://127.0.0.1:" + std::to_string(first.port()) + "/");
+    assert(first.accepted() == 2);
+
+    std::cout << "✓ Pool limit tests passed" << std::endl;
+}
+
+/**
+ * @brief Feed a response to the parser in fixed-size pieces, the way the
+ *        receive loop does, and collect the body
+ */
+std::string parse_in_pieces(conduit::ResponseParser& parser, const std::string& raw, size_t piece) {
+    std::string buffer;
+    std::string body;
+    size_t offset = 0;
+
+    while (!parser.complete()) {
+        std::string_view chunk;
+        size_t consumed = parser.feed(buffer.data(), buffer.size(), chunk);
+        body.append(chunk);
+        buffer.erase(0, consumed);
+        if (consumed > 0) {
+            continue;
+        }
+
+        if (offset == raw.size()) {
+            parser.finish();
+            break;
+        }
+        size_t take = std::min(piece, raw.size() - offset);
+        buffer.append(raw, offset, take);
+        offset += take;
+    }
+    return body;
+}
+
+void test_response_parser() {
+    std::cout << "Testing incremental response parser..." << std::endl;
+
+    std::string raw = "HTTP/1.1 201 Created\r\n"
+                      "content-length: 11\r\n"
+                      "X-Trace:   abc \r\n"
+                      "Set-Cookie: a=1; Path=/\r\n"
+                      "set-cookie: b=2\r\n"
+                      "\r\n"
+                      "hello world";
+
+    for (size_t piece : {1, 2, 7, 4096}) {
+        conduit::ResponseParser parser;
+        std::string body = parse_in_pieces(parser, raw, piece);
+        assert(parser.complete());
+        assert(parser.status_code() == 201);
+        assert(parser.content_length() == 11);
+        assert(parser.keep_alive());
+        assert(parser.headers().get("X-Trace") == "abc");
+        assert(parser.headers().get(conduit::header::content_length) == "11");
+        assert((parser.headers().get_all("Set-Cookie") == std::vector<std::string_view>{"a=1; Path=/", "b=2"}));
+        assert(body == "hello world");
+    }
+
+    // No framing header: the body runs until the peer closes
+    conduit::ResponseParser until_close;
+    std::string body = parse_in_pieces(until_close, "HTTP/1.0 200 OK\r\n\r\nstreamed", 3);
+    assert(until_close.complete());
+    assert(!until_close.keep_alive());
+    assert(body == "streamed");
+
+    // Garbage status lines and oversized header blocks are rejected
+    bool threw = false;
+    try {
+        conduit::ResponseParser parser;
+        parse_in_pieces(parser, "SMTP ready\r\n\r\n", 4096);
+    } catch (const conduit::ResponseException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        conduit::ResponseParser parser;
+        std::string huge = "HTTP/1.1 200 OK\r\nX-Big: " +
+                           std::string(conduit::ResponseParser::MAX_HEADER_BYTES, 'x');
+        parse_in_pieces(parser, huge, 4096);
+    } catch (const conduit::ResponseException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // A length past INT64_MAX is rejected, not taken for "read until close"
+    for (const char* length : {"9223372036854775808", "9999999999999999999"}) {
+        threw = false;
+        try {
+            conduit::ResponseParser parser;
+            parse_in_pieces(parser, std::string("HTTP/1.1 200 OK\r\nContent-Length: ") + length +
+                                    "\r\n\r\nbody", 4096);
+        } catch (const conduit::ResponseException&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    conduit::ResponseParser largest;
+    parse_in_pieces(largest, "HTTP/1.1 200 OK\r\nContent-Length: 9223372036854775807\r\n\r\n", 4096);
+    assert(largest.content_length() == INT64_MAX);
+
+    std::cout << "✓ Incremental response parser tests passed" << std::endl;
+}
+
+void test_response_framing() {
+    std::cout << "Testing chunked and no-body framing..." << std::endl;
+
+    std::string chunked = "HTTP/1.1 200 OK\r\n"
+                          "TRANSFER-ENCODING: gzip, Chunked\r\n"
+                          "\r\n"
+                          "5;ext=1\r\nhello\r\n"
+                          "1\r\n \r\n"
+                          "A\r\nchunked!!!\r\n"
+                          "0\r\n"
+                          "X-Checksum: 42\r\n"
+                          "\r\n";
+    for (size_t piece : {1, 3, 4096}) {
+        conduit::ResponseParser parser;
+        std::string body = parse_in_pieces(parser, chunked, piece);
+        assert(parser.complete());
+        assert(parser.chunked());
+        assert(parser.keep_alive());
+        assert(body == "hello chunked!!!");
+        assert(parser.headers().get("x-checksum") == "42");
+    }
+
+    // Interim 100 Continue is skipped, 204 has no body even without a length
+    conduit::ResponseParser no_content;
+    std::string body = parse_in_pieces(no_content,
+        "HTTP/1.1 100 Continue\r\n\r\nHTTP/1.1 204 No Content\r\nX-A: b\r\n\r\n", 4096);
+    assert(no_content.complete());
+    assert(no_content.status_code() == 204);
+    assert(no_content.keep_alive());
+    assert(body.empty());
+
+    // HEAD replies advertise a length they do not send
+    conduit::ResponseParser head;
+    head.reset(true);
+    parse_in_pieces(head, "HTTP/1.1 200 OK\r\nContent-Length: 1234\r\n\r\n", 4096);
+    assert(head.complete());
+    assert(head.keep_alive());
+
+    // Transfer-Encoding overrides Content-Length and poisons the stream
+    conduit::ResponseParser both;
+    body = parse_in_pieces(both,
+        "HTTP/1.1 200 OK\r\nContent-Length: 100\r\nTransfer-Encoding: chunked\r\n\r\n"
+        "2\r\nok\r\n0\r\n\r\n", 4096);
+    assert(both.complete());
+    assert(body == "ok");
+    assert(!both.keep_alive());
+
+    // Connection options are a token list
+    conduit::ResponseParser closing;
+    parse_in_pieces(closing, "HTTP/1.1 200 OK\r\nconnection: Upgrade, CLOSE\r\ncontent-length: 0\r\n\r\n", 4096);
+    assert(closing.complete());
+    assert(!closing.keep_alive());
+
+    bool threw = false;
+    try {
+        conduit::ResponseParser parser;
+        parse_in_pieces(parser, "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n", 4096);
+    } catch (const conduit::ResponseException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✓ Chunked and no-body framing tests passed" << std::endl;
+}
+
+void run_async_concurrent_requests(conduit::IoBackendType backend) {
+    std::string large(1024 * 1024, 'x');
+    TestServer server([&](const std::string& request) {
+        size_t start = request.find(' ') + 1;
+        std::string path = request.substr(start, request.find(' ', start) - start);
+        return ok_response(path == "/large" ? large : path);
+    });
+    std::string base = "http://127.0.0.1:" + std::to_string(server.port());
+
+    conduit::ClientConfig config;
+    config.io_backend = backend;
+    conduit::EventLoop loop(config);
+    conduit::AsyncClient client(loop, config);
+    std::cout << "  backend: " << loop.backend_name() << std::endl;
+
+    // More than the io_uring submission queue holds, so it fills and flushes
+    constexpr int REQUESTS = 300;
+    std::vector<std::string> bodies(REQUESTS);
+    int completed = 0;
+    for (int i = 0; i < REQUESTS; ++i) {
+        client.get(base + "/item/" + std::to_string(i),
+                   [&, i](std::exception_ptr error, std::optional<conduit::Response> response) {
+            assert(!error);
+            assert(response->status_code() == 200);
+            bodies[i] = response->body();
+            ++completed;
+        });
+    }
+    assert(client.in_flight() == REQUESTS);
+
+    // Nothing completes until the loop runs
+    assert(completed == 0);
+    loop.run();
+    assert(completed == REQUESTS);
+    assert(client.in_flight() == 0);
+    for (int i = 0; i < REQUESTS; ++i) {
+        assert(bodies[i] == "/item/" + std::to_string(i));
+    }
+
+    // Idle connections are capped per host and reused by later requests
+    assert(client.idle_connections() == conduit::ClientConfig{}.max_idle_per_host);
+    int accepted = server.accepted();
+    int chained = 0;
+    std::function<void()> next = [&] {
+        client.get(base + "/chain", [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+            assert(!error && response->body() == "/chain");
+            if (++chained < 5) {
+                next();
+            }
+        });
+    };
+    next();
+    loop.run();
+    assert(chained == 5);
+    assert(server.accepted() == accepted);
+
+    // Bodies much larger than the backend's receive buffers
+    int large_done = 0;
+    for (int i = 0; i < 3; ++i) {
+        client.get(base + "/large", [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+            assert(!error && response->body() == large);
+            ++large_done;
+        });
+    }
+    loop.run();
+    assert(large_done == 3);
+}
+
+void test_async_concurrent_requests() {
+    std::cout << "Testing concurrent asynchronous requests..." << std::endl;
+
+    {
+        conduit::EventLoop loop;
+        assert(std::string(loop.backend_name()) == "epoll");
+    }
+
+    // io_uring where the kernel supports it, epoll otherwise
+    run_async_concurrent_requests(conduit::IoBackendType::Epoll);
+    run_async_concurrent_requests(conduit::IoBackendType::IoUring);
+
+    std::cout << "✓ Concurrent asynchronous request tests passed" << std::endl;
+}
+
+void test_async_futures() {
+    std::cout << "Testing future-based asynchronous requests..." << std::endl;
+
+    TestServer server([](const std::string& request) {
+        return ok_response(request.substr(request.find("\r\n\r\n") + 4), "Content-Type: application/json\r\n");
+    });
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/echo";
+
+    conduit::EventLoop loop;
+    conduit::AsyncClient client(loop);
+
+    // Keep the loop alive while requests are issued from this thread
+    std::atomic<bool> done{false};
+    std::thread runner([&] {
+        while (!done) {
+            loop.run_once(std::chrono::milliseconds(10));
+        }
+    });
+
+    std::vector<std::future<conduit::Response>> futures;
+    for (int i = 0; i < 10; ++i) {
+        auto object = std::make_shared<std::map<std::string, std::shared_ptr<conduit::JsonValue>>>();
+        (*object)["id"] = std::make_shared<conduit::JsonValue>(static_cast<double>(i));
+        conduit::JsonValue json;
+        json.set_object(object);
+        futures.push_back(client.post_json_future(url, json));
+    }
+    for (int i = 0; i < 10; ++i) {
+        auto response = futures[i].get();
+        assert(response.status_code() == 200);
+        assert(response.json().has_value());
+        assert(response.json()->get_int("id") == i);
+    }
+
+    // Errors surface through the future
+    auto failed = client.get_future("http://host.invalid/");
+    bool threw = false;
+    try {
+        failed.get();
+    } catch (const conduit::ConnectionException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    done = true;
+    runner.join();
+
+    std::cout << "✓ Future-based asynchronous request tests passed" << std::endl;
+}
+
+void test_shared_response_json() {
+    std::cout << "Testing JSON access to one Response from several threads..." << std::endl;
+
+    // As a std::shared_future<Response> hands it out: one const Response, many readers
+    std::string body = R"({"items": [1, 2, 3], "name": "shared"})";
+    for (int round = 0; round < 50; ++round) {
+        const conduit::Response response(200, body, {{"Content-Type", "application/json"}});
+        const conduit::Response copy = response;
+        std::vector<const std::optional<conduit::JsonValue>*> seen(8);
+        std::vector<std::thread> readers;
+        for (size_t i = 0; i < seen.size(); ++i) {
+            readers.emplace_back([&, i] { seen[i] = &(i % 2 ? copy : response).json(); });
+        }
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        for (auto* json : seen) {
+            assert(json == seen[0]);
+            assert((*json)->get_string("name") == std::optional<std::string>("shared"));
+        }
+    }
+
+    std::cout << "✓ Shared Response JSON tests passed" << std::endl;
+}
+
+void test_async_errors() {
+    std::cout << "Testing asynchronous error handling..." << std::endl;
+
+    // A port with nothing listening
+    int probe = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(probe, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    socklen_t len = sizeof(addr);
+    getsockname(probe, reinterpret_cast<sockaddr*>(&addr), &len);
+    close(probe);
+
+    for (auto backend : {conduit::IoBackendType::Epoll, conduit::IoBackendType::IoUring}) {
+        conduit::ClientConfig config;
+        config.io_backend = backend;
+        conduit::EventLoop loop(config);
+        conduit::AsyncClient client(loop, config);
+
+        bool refused = false;
+        client.get("http://127.0.0.1:" + std::to_string(ntohs(addr.sin_port)) + "/",
+                   [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+            assert(error && !response);
+            try {
+                std::rethrow_exception(error);
+            } catch (const conduit::ConnectionException&) {
+                refused = true;
+            }
+        });
+        loop.run();
+        assert(refused);
+
+        // The server drops every connection after replying; a request racing
+        // the close on a reused socket is retried on a fresh one
+        TestServer server([](const std::string&) { return ok_response("once"); }, true);
+        std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/";
+        int succeeded = 0;
+        auto count = [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+            assert(!error && response->body() == "once");
+            ++succeeded;
+        };
+        client.get(url, count);
+        loop.run();
+        client.get(url, count);
+        loop.run();
+        assert(succeeded == 2);
+        assert(server.accepted() == 2);
+
+        // A callback reached through a posted task may destroy the client:
+        // here a cancel issued from another thread
+        TestServer silent([](const std::string&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            return ok_response("late");
+        });
+        auto owned = std::make_unique<conduit::AsyncClient>(loop, config);
+        bool cancelled = false;
+        std::thread([&] {
+            auto id = owned->get("http://127.0.0.1:" + std::to_string(silent.port()) + "/",
+                                 [&](std::exception_ptr error, std::optional<conduit::Response>) {
+                try {
+                    std::rethrow_exception(error);
+                } catch (const conduit::CancelledException&) {
+                    cancelled = true;
+                }
+                owned.reset();
+            });
+            owned->cancel(id);
+        }).join();
+        loop.run();
+        assert(cancelled && !owned);
+
+        // A POST the server read before dropping the reused socket is not resent
+        TestServer dropping([](const std::string& request) {
+            return request.compare(0, 5, "POST ") == 0 ? std::string() : ok_response("ok");
+        });
+        std::string dropping_url = "http://127.0.0.1:" + std::to_string(dropping.port()) + "/";
+        client.get(dropping_url, [](std::exception_ptr error, std::optional<conduit::Response>) {
+            assert(!error);
+        });
+        loop.run();
+        bool dropped = false;
+        client.post(dropping_url, "charge=1", "application/x-www-form-urlencoded",
+                    [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+            dropped = error && !response;
+        });
+        loop.run();
+        assert(dropped);
+        assert(dropping.requests() == 2);
+        assert(dropping.accepted() == 1);
+
+        // Cancelling an upload the peer never reads closes the socket with
+        // the send still in flight; the request and its bytes go away at once
+        int sink = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in sink_addr{};
+        sink_addr.sin_family = AF_INET;
+        sink_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(sink, reinterpret_cast<sockaddr*>(&sink_addr), sizeof(sink_addr));
+        listen(sink, 1);
+        socklen_t sink_len = sizeof(sink_addr);
+        getsockname(sink, reinterpret_cast<sockaddr*>(&sink_addr), &sink_len);
+
+        bool upload_cancelled = false;
+        auto upload = client.post("http://127.0.0.1:" + std::to_string(ntohs(sink_addr.sin_port)) + "/",
+                                  std::string(32 * 1024 * 1024, 'u'), "application/octet-stream",
+                                  [&](std::exception_ptr error, std::optional<conduit::Response>) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const conduit::CancelledException&) {
+                upload_cancelled = true;
+            }
+        });
+        loop.call_after(std::chrono::milliseconds(50), [&] { client.cancel(upload); });
+        loop.run();
+        assert(upload_cancelled);
+        close(sink);
+    }
+
+    std::cout << "✓ Asynchronous error handling tests passed" << std::endl;
+}
+
+void test_dns_resolution() {
+    std::cout << "Testing DNS caching and overrides..." << std::endl;
+
+    TestServer server([](const std::string&) { return ok_response("resolved"); });
+    std::string port = std::to_string(server.port());
+
+    conduit::clear_dns_cache();
+
+    // Overrides bypass DNS entirely, for both clients
+    conduit::ClientConfig config;
+    config.host_overrides["service.test"] = {"127.0.0.1"};
+    conduit::HttpClient sync_client(config);
+    assert(sync_client.get("http://service.test:" + port + "/").body() == "resolved");
+
+    for (auto backend : {conduit::IoBackendType::Epoll, conduit::IoBackendType::IoUring}) {
+        config.io_backend = backend;
+        conduit::EventLoop loop(config);
+        conduit::AsyncClient client(loop, config);
+
+        // An override, then a name that needs a real lookup off the loop thread
+        int succeeded = 0;
+        for (const std::string host : {"service.test", "localhost"}) {
+            client.get("http://" + host + ":" + port + "/",
+                       [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+                assert(!error && response->body() == "resolved");
+                ++succeeded;
+            });
+        }
+        loop.run();
+        assert(succeeded == 2);
+    }
+
+    // Failed lookups are remembered for dns_negative_ttl
+    conduit::HttpClient plain_client;
+    bool threw = false;
+    try {
+        plain_client.get("http://nothing-here.invalid/");
+    } catch (const conduit::ConnectionException&) {
+        threw = true;
+    }
+    assert(threw);
+
+    auto start = std::chrono::steady_clock::now();
+    threw = false;
+    try {
+        plain_client.get("http://nothing-here.invalid/");
+    } catch (const conduit::ConnectionException&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(5));
+
+    // Literals and overrides count as resolved without a query
+    assert(conduit::prewarm_dns({"service.test", "127.0.0.1", "localhost", "nothing-here.invalid"}, config) == 3);
+
+    conduit::clear_dns_cache();
+
+    std::cout << "✓ DNS caching and override tests passed" << std::endl;
+}
+
+/**
+ * @brief A listener on 127.0.0.2 whose accept queue is full, so further
+ *        SYNs are dropped and connects to it hang
+ */
+class BlackHole {
+public:
+    explicit BlackHole(int port) {
+        listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(0x7f000002);
+        addr.sin_port = htons(static_cast<uint16_t>(port));
+        bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        listen(listen_fd_, 0);
+        for (int& filler : fillers_) {
+            filler = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+            connect(filler, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    ~BlackHole() {
+        for (int filler : fillers_) {
+            close(filler);
+        }
+        close(listen_fd_);
+    }
+
+private:
+    int listen_fd_;
+    int fillers_[2];
+};
+
+void test_happy_eyeballs() {
+    std::cout << "Testing Happy Eyeballs connection racing..." << std::endl;
+
+    // Families alternate, preferring IPv6 until another family wins
+    conduit::clear_dns_cache();
+    conduit::ClientConfig config;
+    config.host_overrides["dual.test"] = {"127.0.0.1", "127.0.0.2", "::1"};
+    auto& resolver = conduit::Resolver::shared();
+    auto families = [&] {
+        std::vector<int> result;
+        for (const auto& endpoint : resolver.connect_order("dual.test", resolver.resolve("dual.test", 80, config))) {
+            result.push_back(endpoint.addr.ss_family);
+        }
+        return result;
+    };
+    assert((families() == std::vector<int>{AF_INET6, AF_INET, AF_INET}));
+    resolver.remember_family("dual.test", AF_INET);
+    assert((families() == std::vector<int>{AF_INET, AF_INET6, AF_INET}));
+    conduit::clear_dns_cache();
+
+    TestServer server([](const std::string&) { return ok_response("raced"); });
+    std::string port = std::to_string(server.port());
+    BlackHole black_hole(server.port());
+
+    config.host_overrides["race.test"] = {"127.0.0.2", "127.0.0.1"};
+    config.host_overrides["hang.test"] = {"127.0.0.2"};
+    config.connection_attempt_delay = std::chrono::milliseconds(100);
+    config.connect_timeout = std::chrono::milliseconds(400);
+
+    // An unresponsive first address costs one attempt delay, not a SYN timeout
+    auto start = std::chrono::steady_clock::now();
+    conduit::HttpClient sync_client(config);
+    assert(sync_client.get("http://race.test:" + port + "/").body() == "raced");
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(elapsed >= std::chrono::milliseconds(90) && elapsed < std::chrono::milliseconds(350));
+
+    // connect_timeout bounds the connect alone
+    start = std::chrono::steady_clock::now();
+    bool timed_out = false;
+    try {
+        sync_client.get("http://hang.test:" + port + "/");
+    } catch (const conduit::TimeoutException&) {
+        timed_out = true;
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+    assert(timed_out);
+    assert(elapsed >= std::chrono::milliseconds(390) && elapsed < std::chrono::milliseconds(900));
+
+    for (auto backend : {conduit::IoBackendType::Epoll, conduit::IoBackendType::IoUring}) {
+        config.io_backend = backend;
+        conduit::EventLoop loop(config);
+        conduit::AsyncClient client(loop, config);
+
+        start = std::chrono::steady_clock::now();
+        bool raced = false;
+        client.get("http://race.test:" + port + "/",
+                   [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+            assert(!error && response->body() == "raced");
+            raced = true;
+        });
+        loop.run();
+        elapsed = std::chrono::steady_clock::now() - start;
+        assert(raced);
+        assert(elapsed >= std::chrono::milliseconds(90) && elapsed < std::chrono::milliseconds(350));
+
+        start = std::chrono::steady_clock::now();
+        timed_out = false;
+        client.get("http://hang.test:" + port + "/",
+                   [&](std::exception_ptr error, std::optional<conduit::Response> response) {
+            assert(error && !response);
+            try {
+                std::rethrow_exception(error);
+            } catch (const conduit::TimeoutException&) {
+                timed_out = true;
+            }
+        });
+        loop.run();
+        elapsed = std::chrono::steady_clock::now() - start;
+        assert(timed_out);
+        assert(elapsed >= std::chrono::milliseconds(390) && elapsed < std::chrono::milliseconds(900));
+    }
+
+    std::cout << "✓ Happy Eyeballs tests passed" << std::endl;
+}
+
+void test_timer_wheel() {
+    std::cout << "Testing timer wheel..." << std::endl;
+
+    using namespace std::chrono;
+    conduit::TimerWheel wheel;
+    auto start = conduit::TimerWheel::Clock::now();
+    std::vector<int> fired;
+
+    wheel.add(milliseconds(5), [&] { fired.push_back(5); });
+    auto cancelled = wheel.add(milliseconds(10), [&] { fired.push_back(10); });
+    // Beyond one revolution of the wheel
+    wheel.add(milliseconds(2500), [&] { fired.push_back(2500); });
+    assert(wheel.size() == 3);
+    assert(wheel.next_timeout_ms() >= 0 && wheel.next_timeout_ms() <= 6);
+
+    assert(wheel.cancel(cancelled));
+    assert(!wheel.cancel(cancelled));
+
+    auto run = [&](milliseconds at) {
+        for (auto& task : wheel.expire(start + at)) {
+            task();
+        }
+    };
+
+    run(milliseconds(2));
+    assert(fired.empty());
+    run(milliseconds(20));
+    assert(fired == std::vector<int>{5});
+
+    // Passing the 2500ms timer's slot a revolution early must not fire it
+    run(milliseconds(1500));
+    assert(fired.size() == 1);
+    assert(wheel.size() == 1);
+    run(milliseconds(2600));
+    assert((fired == std::vector<int>{5, 2500}));
+    assert(wheel.empty());
+    assert(wheel.next_timeout_ms() == -1);
+
+    std::cout << "✓ Timer wheel tests passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Conduit C++ HTTP Tests" << std::endl;
+    std::cout << "==============================" << std::endl;
+
+    try {
+        test_response_parser();
+        test_response_framing();
+        test_timer_wheel();
+        test_pool_reuses_connections();
+        test_pool_honours_connection_close();
+        test_pool_drops_stale_connections();
+        test_pool_does_not_resend_post();
+        test_chunked_keep_alive();
+        test_streaming_body();
+        test_json_streaming();
+        test_json_lines_streaming();
+        test_request_serialization();
+        test_request_templates();
+        test_query_and_form_requests();
+        test_post_json_body();
+        test_pool_limits();
+        test_pipelining();
+        test_async_concurrent_requests();
+        test_async_futures();
+        test_shared_response_json();
+        test_async_errors();
+        test_dns_resolution();
+        test_happy_eyeballs();
+
+        std::cout << std::endl;
+        std::cout << "🎉 All tests passed!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "❌ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+#ifndef CONDUIT_TEST_SERVER_HPP
+#define CONDUIT_TEST_SERVER_HPP
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+/**
+ * @brief Minimal loopback HTTP server for exercising the client
+ *
+ * Every accepted connection is served on its own thread. The handler gets
+ * the raw request (head and body) and returns the raw bytes to write back;
+ * the connection stays open for further requests unless the reply contains
+ * "Connection: close" or the server was told to close after every reply.
+ * An empty reply closes the connection without answering.
+ */
+class TestServer {
+public:
+    using Handler = std::function<std::string(const std::string& request)>;
+
+    explicit TestServer(Handler handler, bool close_after_reply = false)
+        : handler_(std::move(handler)), close_after_reply_(close_after_reply) {
+        listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+        int enable = 1;
+        setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        listen(listen_fd_, 64);
+
+        socklen_t len = sizeof(addr);
+        getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len);
+        port_ = ntohs(addr.sin_port);
+
+        acceptor_ = std::thread([this] { accept_loop(); });
+    }
+
+    ~TestServer() {
+        stopping_ = true;
+        shutdown(listen_fd_, SHUT_RDWR);
+        close(listen_fd_);
+        acceptor_.join();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int fd : client_fds_) {
+            shutdown(fd, SHUT_RDWR);
+        }
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+        for (int fd : client_fds_) {
+            close(fd);
+        }
+    }
+
+    int port() const { return port_; }
+    int accepted() const { return accepted_; }
+    int requests() const { return requests_; }
+
+private:
+    Handler handler_;
+    bool close_after_reply_;
+    int listen_fd_;
+    int port_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<int> accepted_{0};
+    std::atomic<int> requests_{0};
+    std::thread acceptor_;
+    std::mutex mutex_;
+    std::vector<std::thread> workers_;
+    std::vector<int> client_fds_;
+
+    void accept_loop() {
+        while (!stopping_) {
+            int fd = accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0) {
+                return;
+            }
+            ++accepted_;
+            std::lock_guard<std::mutex> lock(mutex_);
+            client_fds_.push_back(fd);
+            workers_.emplace_back([this, fd] { serve(fd); });
+        }
+    }
+
+    void serve(int fd) {
+        std::string pending;
+        char buffer[4096];
+
+        while (true) {
+            size_t head_end;
+            while ((head_end = pending.find("\r\n\r\n")) == std::string::npos) {
+                ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+                if (n <= 0) return;
+                pending.append(buffer, n);
+            }
+
+            size_t body_length = 0;
+            size_t cl = pending.find("Content-Length: ");
+            if (cl != std::string::npos && cl < head_end) {
+                body_length = std::stoul(pending.substr(cl + 16));
+            }
+            size_t request_length = head_end + 4 + body_length;
+            while (pending.size() < request_length) {
+                ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+                if (n <= 0) return;
+                pending.append(buffer, n);
+            }
+
+            std::string request = pending.substr(0, request_length);
+            pending.erase(0, request_length);
+            ++requests_;
+
+            std::string reply = handler_(request);
+            if (reply.empty()) {
+                shutdown(fd, SHUT_RDWR);
+                return;
+            }
+            send(fd, reply.data(), reply.size(), MSG_NOSIGNAL);
+            if (close_after_reply_ || reply.find("Connection: close") != std::string::npos) {
+                shutdown(fd, SHUT_RDWR);
+                return;
+            }
+        }
+    }
+};
+
+inline std::string ok_response(const std::string& body, const std::string& extra_headers = "") {
+    return "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: " +
+           std::to_string(body.size()) + "\r\n" + extra_headers + "\r\n" + body;
+}
+
+#endif // CONDUIT_TEST_SERVER_HPP